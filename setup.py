@@ -8,10 +8,21 @@ ext_modules = [
         "src/main.cpp",
         "src/image/Image.cpp",
         "src/graph/Graph.cpp",
+        "src/graph/DisjointSet.cpp",
         "src/maze/Maze.cpp",
         "src/interface/Interface.cpp",
         "src/algorithms/Algorithm.cpp",
+        "src/algorithms/Random.cpp",
         "src/algorithms/type/KruskalAlgorithm.cpp",
+        "src/algorithms/type/ParallelKruskalAlgorithm.cpp",
+        "src/algorithms/type/RecursiveBacktrackerAlgorithm.cpp",
+        "src/algorithms/type/EllersAlgorithm.cpp",
+        "src/algorithms/type/WilsonsAlgorithm.cpp",
+        "src/algorithms/type/PrimsAlgorithm.cpp",
+        "src/algorithms/type/BinaryTreeAlgorithm.cpp",
+        "src/algorithms/type/SidewinderAlgorithm.cpp",
+        "src/algorithms/type/RecursiveDivisionAlgorithm.cpp",
+        "src/algorithms/type/HuntAndKillAlgorithm.cpp",
         "src/algorithms/type/DepthFirstSearchAlgorithm.cpp",
         "src/method/Method.cpp",
         "src/method/type/ImageSavingMethod.cpp",
@@ -19,10 +30,13 @@ ext_modules = [
         "src/method/type/TextFileLoadingMethod.cpp",
         "src/method/type/TextFileSavingMethod.cpp",
         "src/algorithms/type/BreadthFirstSearchAlgorithm.cpp",
+        "src/algorithms/type/BidirectionalBreadthFirstSearchAlgorithm.cpp",
         "src/algorithms/type/TremauxsAlgorithm.cpp",
         "src/algorithms/type/WallFollowingAlgorithm.cpp",
         "src/algorithms/type/DijkstraAlgorithm.cpp",
-        "src/algorithms/type/LeeAlgorithm.cpp"
+        "src/algorithms/type/LeeAlgorithm.cpp",
+        "src/algorithms/type/AStarAlgorithm.cpp",
+        "src/algorithms/type/DeadEndFillingAlgorithm.cpp"
     ]),
 ]
 
@@ -94,6 +94,15 @@ std::vector<std::shared_ptr<GeneratingAlgorithm>> Algorithm::getGenerators() {
     std::vector<std::shared_ptr<GeneratingAlgorithm>> generators;
 
     generators.push_back(std::make_shared<KruskalAlgorithm>());
+    generators.push_back(std::make_shared<ParallelKruskalAlgorithm>());
+    generators.push_back(std::make_shared<RecursiveBacktrackerAlgorithm>());
+    generators.push_back(std::make_shared<EllersAlgorithm>());
+    generators.push_back(std::make_shared<WilsonsAlgorithm>());
+    generators.push_back(std::make_shared<PrimsAlgorithm>());
+    generators.push_back(std::make_shared<BinaryTreeAlgorithm>());
+    generators.push_back(std::make_shared<SidewinderAlgorithm>());
+    generators.push_back(std::make_shared<RecursiveDivisionAlgorithm>());
+    generators.push_back(std::make_shared<HuntAndKillAlgorithm>());
 
     return generators;
 }
@@ -133,8 +142,11 @@ std::vector<std::shared_ptr<SolvingAlgorithm>> Algorithm::getSolvers() {
     std::vector<std::shared_ptr<SolvingAlgorithm>> generators;
 
     generators.push_back(std::make_shared<BreadthFirstSearchAlgorithm>());
+    generators.push_back(std::make_shared<BidirectionalBreadthFirstSearchAlgorithm>());
     generators.push_back(std::make_shared<DepthFirstSearchAlgorithm>());
     generators.push_back(std::make_shared<DijkstraAlgorithm>());
+    generators.push_back(std::make_shared<AStarAlgorithm>());
+    generators.push_back(std::make_shared<DeadEndFillingAlgorithm>());
     generators.push_back(std::make_shared<LeeAlgorithm>());
     generators.push_back(std::make_shared<TremauxsAlgorithm>());
     generators.push_back(std::make_shared<WallFollowingAlgorithm>());
@@ -185,6 +197,170 @@ void GeneratingAlgorithm::setSeed(unsigned int seed) {
     this->seed = seed;
 }
 
+/**
+ * Sets the number of worker threads used by parallel generators
+ * @param threads number of threads, 0 or less to use all hardware threads
+ */
+void GeneratingAlgorithm::setThreads(int threads) {
+    this->threads = threads;
+}
+
+/**
+ * Returns the number of worker threads used by parallel generators
+ * @return number of threads, at least 1
+ */
+int GeneratingAlgorithm::getThreads() const {
+    if (this->threads > 0) {
+        return this->threads;
+    }
+
+    return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+/**
+ * Runs a kernel for every task index on the worker threads, the workers pick indices from a shared counter
+ * @param count number of tasks
+ * @param kernel function called once for every task index
+ */
+void GeneratingAlgorithm::forEachTask(int count, const std::function<void(int index)> &kernel) const {
+    Algorithm::forEachTask(count, this->getThreads(), kernel);
+}
+
+/**
+ * Runs a kernel for every task index on a given number of worker threads
+ * @param count number of tasks
+ * @param threads number of worker threads, at least 1
+ * @param kernel function called once for every task index
+ */
+void Algorithm::forEachTask(int count, int threads, const std::function<void(int index)> &kernel) {
+    std::atomic<int> next(0);
+
+    auto worker = [&]() {
+        for (int index = next++; index < count; index = next++) {
+            kernel(index);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    int workers = std::min(threads, count);
+
+    for (int i = 1; i < workers; i++) {
+        pool.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto &thread: pool) {
+        thread.join();
+    }
+}
+
+/**
+ * Runs a kernel for every row of the maze, rows are handed to the worker threads in fixed size blocks.
+ * Rows never share a word of the grid, so kernels writing only their own row need no locking.
+ * @param height number of rows
+ * @param kernel function called once for every row
+ */
+void GeneratingAlgorithm::forEachRow(int height, const std::function<void(int y)> &kernel) const {
+    const int block = 64;
+
+    this->forEachTask((height + block - 1) / block, [&](int index) {
+        for (int y = index * block; y < std::min(height, (index + 1) * block); y++) {
+            kernel(y);
+        }
+    });
+}
+
+/**
+ * Derive the seed of a maze in a batch from the base seed and the index of the maze
+ * @param baseSeed seed of the batch
+ * @param index index of the maze in the batch
+ * @return seed of the maze, always greater than 0
+ */
+unsigned int GeneratingAlgorithm::getBatchSeed(unsigned int baseSeed, int index) {
+    unsigned int seed = static_cast<unsigned int>(Random(baseSeed, static_cast<uint64_t>(index)).next() >> 32);
+
+    return seed == 0 ? 1 : seed;
+}
+
+/**
+ * Generate a batch of mazes on a pool of worker threads, the results are returned in order of their index
+ * @param count number of mazes
+ * @param width width of the mazes
+ * @param height height of the mazes
+ * @param baseSeed seed of the batch, maze i is generated with getBatchSeed(baseSeed, i)
+ * @param threads number of worker threads, 0 or less to use all hardware threads
+ * @return generated mazes
+ */
+std::vector<Expected<MazeBuilder>> GeneratingAlgorithm::generateBatch(int count, int width, int height,
+                                                                      unsigned int baseSeed, int threads) {
+    std::vector<std::optional<Expected<MazeBuilder>>> slots(std::max(count, 0));
+
+    this->generateBatch(count, width, height, baseSeed, threads, [&](int index, Expected<MazeBuilder> &maze) {
+        slots[index] = std::move(maze);
+    });
+
+    std::vector<Expected<MazeBuilder>> mazes;
+    mazes.reserve(slots.size());
+
+    for (auto &slot: slots) {
+        mazes.push_back(std::move(slot.value()));
+    }
+
+    return mazes;
+}
+
+/**
+ * Generate a batch of mazes on a pool of worker threads and hand every maze to a sink as soon as it is done.
+ * Every worker owns its own instance of the algorithm, which runs single threaded. The sink is called
+ * concurrently from the workers in completion order and must be thread safe. The mazes start in the top left
+ * corner and end in the bottom right one.
+ * @param count number of mazes
+ * @param width width of the mazes
+ * @param height height of the mazes
+ * @param baseSeed seed of the batch, maze i is generated with getBatchSeed(baseSeed, i)
+ * @param threads number of worker threads, 0 or less to use all hardware threads
+ * @param sink function called once for every maze with its index
+ */
+void GeneratingAlgorithm::generateBatch(int count, int width, int height, unsigned int baseSeed, int threads,
+                                        const std::function<void(int index, Expected<MazeBuilder> &maze)> &sink) {
+    if (count <= 0) {
+        return;
+    }
+
+    if (threads <= 0) {
+        threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    int workers = std::min(threads, count);
+
+    // Algorithms keep state between calls, so every worker gets a fresh instance
+    std::vector<std::shared_ptr<GeneratingAlgorithm>> instances;
+
+    for (int i = 0; i < workers; i++) {
+        instances.push_back(Algorithm::getGenerator(this->getName(), baseSeed));
+        instances.back()->setThreads(1);
+    }
+
+    std::atomic<int> next(0);
+
+    Algorithm::forEachTask(workers, workers, [&](int worker) {
+        GeneratingAlgorithm &algorithm = *instances[worker];
+
+        for (int index = next++; index < count; index = next++) {
+            algorithm.setSeed(GeneratingAlgorithm::getBatchSeed(baseSeed, index));
+            Expected<MazeBuilder> maze = algorithm.generate(width, height);
+
+            if (!maze.hasError()) {
+                maze.val->setStart({0, 0});
+                maze.val->setEnd({width - 1, height - 1});
+            }
+
+            sink(index, maze);
+        }
+    });
+}
+
 /**
 * =================================================================================================
 */
@@ -197,4 +373,70 @@ SolvingAlgorithm::SolvingAlgorithm(std::string name)
         : Algorithm(name, "solving") {
 
     // empty
+}
+
+/**
+ * Sets the seed used by randomized solvers, every solve restarts from it
+ * @param seed seed of the algorithm
+ */
+void SolvingAlgorithm::setSeed(uint64_t seed) {
+    this->seed = seed;
+}
+
+/**
+* =================================================================================================
+*/
+
+/**
+ * @brief Prepare the scratch state for a solve over the given number of cells.
+ * Starts a new epoch, which invalidates every mark, distance and parent in O(1).
+ * Storage only grows and is reused between solves.
+ * @param size number of cells
+ */
+void SolverScratch::reset(int size) {
+    if (static_cast<int>(this->stamps.size()) < size) {
+        this->stamps.resize(size, 0);
+        this->marks.resize(size);
+        this->distances.resize(size);
+        this->parents.resize(size);
+    }
+
+    // Stamps can not be told apart after a wrap-around, so clear them once every 2^32 solves
+    if (++this->epoch == 0) {
+        std::fill(this->stamps.begin(), this->stamps.end(), 0);
+        this->epoch = 1;
+    }
+}
+
+/**
+ * Returns a general purpose buffer, used as a queue or stack by the solvers.
+ * The buffer is not cleared by reset().
+ * @return buffer
+ */
+std::vector<int> &SolverScratch::getBuffer() {
+    return this->buffer;
+}
+
+/**
+ * @brief Empty the queue and size the circular bucket array for keys up to maxWeight ahead of the last pop
+ * @param maxWeight largest edge weight
+ */
+void BucketQueue::reset(int maxWeight) {
+    uint32_t size = 1;
+
+    while (size <= static_cast<uint32_t>(std::max(maxWeight, 1))) {
+        size *= 2;
+    }
+
+    if (this->buckets.size() < size) {
+        this->buckets.resize(size);
+    }
+
+    for (auto &bucket: this->buckets) {
+        bucket.clear();
+    }
+
+    this->mask = size - 1;
+    this->current = 0;
+    this->count = 0;
 }
\ No newline at end of file
@@ -11,8 +11,16 @@
 #include <chrono>
 #include <map>
 #include <queue>
+#include <limits>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <utility>
+#include <optional>
 #include <iostream>
 #include "../maze/Maze.h"
+#include "../graph/DisjointSet.h"
+#include "Random.h"
 #include "../headers/Expected.h"
 
 
@@ -29,6 +37,8 @@ protected:
     std::string complexity = "O(1)";
     std::string description = "No description";
 
+    static void forEachTask(int count, int threads, const std::function<void(int index)> &kernel);
+
 public:
     Algorithm(std::string name, std::string type);
 
@@ -64,6 +74,12 @@ public:
 class GeneratingAlgorithm : public Algorithm {
 protected:
     unsigned int seed;
+    int threads = 0;
+    Random random;
+
+    void forEachTask(int count, const std::function<void(int index)> &kernel) const;
+
+    void forEachRow(int height, const std::function<void(int y)> &kernel) const;
 
 public:
     /* -- */ GeneratingAlgorithm(std::string name, unsigned int seed);
@@ -72,8 +88,20 @@ public:
 
     void setSeed(unsigned int seed);
 
+    void setThreads(int threads);
+
+    int getThreads() const;
+
     virtual Expected<MazeBuilder> generate(int width, int height) = 0;
 
+    static unsigned int getBatchSeed(unsigned int baseSeed, int index);
+
+    std::vector<Expected<MazeBuilder>> generateBatch(int count, int width, int height, unsigned int baseSeed,
+                                                     int threads);
+
+    void generateBatch(int count, int width, int height, unsigned int baseSeed, int threads,
+                       const std::function<void(int index, Expected<MazeBuilder> &maze)> &sink);
+
 };
 
 class KruskalAlgorithm : public GeneratingAlgorithm {
@@ -85,16 +113,404 @@ public:
     virtual ~KruskalAlgorithm() = default;
 
     Expected<MazeBuilder> generate(int width, int height) override;
+
+    static void carve(Grid &grid, int left, int top, int right, int bottom, Random &random);
+};
+
+class ParallelKruskalAlgorithm : public GeneratingAlgorithm {
+public:
+    /* -- */ ParallelKruskalAlgorithm();
+
+    explicit ParallelKruskalAlgorithm(unsigned int seed);
+
+    virtual ~ParallelKruskalAlgorithm() = default;
+
+    Expected<MazeBuilder> generate(int width, int height) override;
+};
+
+class RecursiveBacktrackerAlgorithm : public GeneratingAlgorithm {
+public:
+    /* -- */ RecursiveBacktrackerAlgorithm();
+
+    explicit RecursiveBacktrackerAlgorithm(unsigned int seed);
+
+    virtual ~RecursiveBacktrackerAlgorithm() = default;
+
+    Expected<MazeBuilder> generate(int width, int height) override;
+};
+
+class EllersAlgorithm : public GeneratingAlgorithm {
+public:
+    /* -- */ EllersAlgorithm();
+
+    explicit EllersAlgorithm(unsigned int seed);
+
+    virtual ~EllersAlgorithm() = default;
+
+    Expected<MazeBuilder> generate(int width, int height) override;
+
+    Expected<int> generateToFile(int width, int height, Coordinate start, Coordinate end, int pathWidth, int wallWidth,
+                                 std::string fileName);
+
+private:
+    std::vector<int> labels;
+    std::vector<int> nextLabels;
+    std::vector<int> parents;
+    std::vector<int> counts;
+    std::vector<int> chosen;
+    std::vector<int> remap;
+    std::vector<uint8_t> down;
+    std::vector<uint8_t> east;
+    std::vector<uint8_t> south;
+
+    void startRows(int width);
+
+    int findLabel(int label);
+
+    void nextRow(bool last);
+};
+
+class WilsonsAlgorithm : public GeneratingAlgorithm {
+public:
+    /* -- */ WilsonsAlgorithm();
+
+    explicit WilsonsAlgorithm(unsigned int seed);
+
+    virtual ~WilsonsAlgorithm() = default;
+
+    Expected<MazeBuilder> generate(int width, int height) override;
+
+    long long getWalkSteps() const;
+
+private:
+    long long walkSteps = 0;
+};
+
+class PrimsAlgorithm : public GeneratingAlgorithm {
+public:
+    /* -- */ PrimsAlgorithm();
+
+    explicit PrimsAlgorithm(unsigned int seed);
+
+    virtual ~PrimsAlgorithm() = default;
+
+    Expected<MazeBuilder> generate(int width, int height) override;
+};
+
+class BinaryTreeAlgorithm : public GeneratingAlgorithm {
+public:
+    /* -- */ BinaryTreeAlgorithm();
+
+    explicit BinaryTreeAlgorithm(unsigned int seed);
+
+    virtual ~BinaryTreeAlgorithm() = default;
+
+    Expected<MazeBuilder> generate(int width, int height) override;
+};
+
+class SidewinderAlgorithm : public GeneratingAlgorithm {
+public:
+    /* -- */ SidewinderAlgorithm();
+
+    explicit SidewinderAlgorithm(unsigned int seed);
+
+    virtual ~SidewinderAlgorithm() = default;
+
+    Expected<MazeBuilder> generate(int width, int height) override;
+};
+
+class RecursiveDivisionAlgorithm : public GeneratingAlgorithm {
+public:
+    /* -- */ RecursiveDivisionAlgorithm();
+
+    explicit RecursiveDivisionAlgorithm(unsigned int seed);
+
+    virtual ~RecursiveDivisionAlgorithm() = default;
+
+    Expected<MazeBuilder> generate(int width, int height) override;
+};
+
+class HuntAndKillAlgorithm : public GeneratingAlgorithm {
+public:
+    /* -- */ HuntAndKillAlgorithm();
+
+    explicit HuntAndKillAlgorithm(unsigned int seed);
+
+    virtual ~HuntAndKillAlgorithm() = default;
+
+    Expected<MazeBuilder> generate(int width, int height) override;
 };
 
 // ------------
 
+/**
+ * @brief Reusable per-solve state indexed by cell, so solvers never copy or mutate the maze graph.
+ *
+ * Every cell carries the epoch in which it was last written. reset() only bumps the epoch, and a cell
+ * whose stamp is older reads back as unmarked, at infinite distance and without a parent. Repeated
+ * solves therefore cost time proportional to the explored region, not to the maze size.
+ */
+class SolverScratch {
+private:
+    uint32_t epoch = 0;
+    std::vector<uint32_t> stamps;
+    std::vector<int> marks;
+    std::vector<int> distances;
+    std::vector<int> parents;
+    std::vector<int> buffer;
+
+    void touch(int index) {
+        if (this->stamps[index] != this->epoch) {
+            this->stamps[index] = this->epoch;
+            this->marks[index] = 0;
+            this->distances[index] = std::numeric_limits<int>::max();
+            this->parents[index] = -1;
+        }
+    }
+
+public:
+    SolverScratch() = default;
+
+    ~SolverScratch() = default;
+
+    void reset(int size);
+
+    int getMark(int index) const {
+        return this->stamps[index] == this->epoch ? this->marks[index] : 0;
+    }
+
+    void setMark(int index, int mark) {
+        this->touch(index);
+        this->marks[index] = mark;
+    }
+
+    int getDistance(int index) const {
+        return this->stamps[index] == this->epoch ? this->distances[index] : std::numeric_limits<int>::max();
+    }
+
+    void setDistance(int index, int distance) {
+        this->touch(index);
+        this->distances[index] = distance;
+    }
+
+    int getParent(int index) const {
+        return this->stamps[index] == this->epoch ? this->parents[index] : -1;
+    }
+
+    void setParent(int index, int parent) {
+        this->touch(index);
+        this->parents[index] = parent;
+    }
+
+    std::vector<int> &getBuffer();
+};
+
+/**
+ * @brief Indexed d-ary min-heap of cells keyed by a 32-bit cost, with decrease-key.
+ *
+ * Costs are compared by their wrapped difference, so they stay ordered after an overflow as long as all
+ * keys in the heap lie within 2^31 of each other. Shortest path searches only hold keys within a few
+ * edge weights of the cost being settled. positions maps every cell to its slot and only grows.
+ */
+template<int Arity>
+class IndexedHeap {
+private:
+    struct Entry {
+        uint32_t key;
+        uint32_t cell;
+    };
+
+    std::vector<Entry> entries;
+    std::vector<uint32_t> positions;
+
+    static bool less(uint32_t a, uint32_t b) {
+        return static_cast<int32_t>(a - b) < 0;
+    }
+
+    void place(uint32_t slot, Entry entry) {
+        this->entries[slot] = entry;
+        this->positions[entry.cell] = slot;
+    }
+
+    void siftUp(uint32_t slot) {
+        Entry entry = this->entries[slot];
+
+        while (slot > 0) {
+            uint32_t parent = (slot - 1) / Arity;
+
+            if (!IndexedHeap::less(entry.key, this->entries[parent].key)) {
+                break;
+            }
+
+            this->place(slot, this->entries[parent]);
+            slot = parent;
+        }
+
+        this->place(slot, entry);
+    }
+
+    void siftDown(uint32_t slot) {
+        Entry entry = this->entries[slot];
+        uint32_t size = static_cast<uint32_t>(this->entries.size());
+
+        while (true) {
+            uint32_t first = slot * Arity + 1;
+
+            if (first >= size) {
+                break;
+            }
+
+            uint32_t best = first;
+            uint32_t last = std::min(first + Arity, size);
+
+            for (uint32_t child = first + 1; child < last; child++) {
+                if (IndexedHeap::less(this->entries[child].key, this->entries[best].key)) {
+                    best = child;
+                }
+            }
+
+            if (!IndexedHeap::less(this->entries[best].key, entry.key)) {
+                break;
+            }
+
+            this->place(slot, this->entries[best]);
+            slot = best;
+        }
+
+        this->place(slot, entry);
+    }
+
+public:
+    static constexpr uint32_t NONE = 0xFFFFFFFFu;
+
+    /**
+     * @brief Empty the heap and make room for cells [0, size), costs time proportional to the cells left in it
+     * @param size number of cells
+     */
+    void reset(int size) {
+        for (const Entry &entry: this->entries) {
+            this->positions[entry.cell] = NONE;
+        }
+
+        this->entries.clear();
+
+        if (static_cast<int>(this->positions.size()) < size) {
+            this->positions.resize(size, NONE);
+        }
+    }
+
+    bool empty() const {
+        return this->entries.empty();
+    }
+
+    int size() const {
+        return static_cast<int>(this->entries.size());
+    }
+
+    bool contains(uint32_t cell) const {
+        return this->positions[cell] != NONE;
+    }
+
+    /**
+     * @brief Insert the cell, or lower its key if it is already in the heap
+     * @param cell cell to insert
+     * @param key cost of the cell
+     */
+    void push(uint32_t cell, uint32_t key) {
+        uint32_t slot = this->positions[cell];
+
+        if (slot == NONE) {
+            slot = static_cast<uint32_t>(this->entries.size());
+            this->entries.push_back({key, cell});
+        } else {
+            this->entries[slot].key = key;
+        }
+
+        this->siftUp(slot);
+    }
+
+    /**
+     * @brief Remove the cell with the lowest key
+     * @param key set to the key of the removed cell
+     * @return removed cell
+     */
+    uint32_t pop(uint32_t &key) {
+        Entry top = this->entries.front();
+        Entry last = this->entries.back();
+
+        this->entries.pop_back();
+        this->positions[top.cell] = NONE;
+
+        if (!this->entries.empty()) {
+            this->entries.front() = last;
+            this->siftDown(0);
+        }
+
+        key = top.key;
+        return top.cell;
+    }
+};
+
+/**
+ * @brief Dial's bucket queue of cells keyed by a 32-bit cost, for edge weights up to a small maximum.
+ *
+ * Keys in the queue never exceed the last popped key by more than the largest weight, so a circular
+ * array of buckets indexed by the low bits of the key is enough. Keys are never decreased, the caller
+ * pushes the cell again and skips stale entries when they are popped.
+ */
+class BucketQueue {
+private:
+    std::vector<std::vector<uint32_t>> buckets;
+    uint32_t mask = 0;
+    uint32_t current = 0;
+    size_t count = 0;
+
+public:
+    void reset(int maxWeight);
+
+    bool empty() const {
+        return this->count == 0;
+    }
+
+    void push(uint32_t cell, uint32_t key) {
+        this->buckets[key & this->mask].push_back(cell);
+        this->count++;
+    }
+
+    /**
+     * @brief Remove a cell with the lowest key
+     * @param key set to the key of the removed cell
+     * @return removed cell
+     */
+    uint32_t pop(uint32_t &key) {
+        while (this->buckets[this->current & this->mask].empty()) {
+            this->current++;
+        }
+
+        std::vector<uint32_t> &bucket = this->buckets[this->current & this->mask];
+        uint32_t cell = bucket.back();
+
+        bucket.pop_back();
+        this->count--;
+
+        key = this->current;
+        return cell;
+    }
+};
+
 class SolvingAlgorithm : public Algorithm {
+protected:
+    SolverScratch scratch;
+    uint64_t seed = 0;
+    Random random;
+
 public:
     explicit SolvingAlgorithm(std::string name);
 
     virtual ~SolvingAlgorithm() = default;
 
+    void setSeed(uint64_t seed);
+
     virtual Expected<MazePath> solve(Maze &maze) = 0;
 
 };
@@ -118,11 +534,35 @@ public:
 };
 
 class BreadthFirstSearchAlgorithm : public SolvingAlgorithm {
+private:
+    bool directionOptimizing = false;
+    std::vector<uint64_t> visited;
+    std::vector<uint64_t> frontier;
+    std::vector<uint64_t> next;
+    std::vector<uint64_t> eastWalls;
+    std::vector<uint64_t> southWalls;
+    std::vector<uint32_t> levels;
+
+    Expected<MazePath> solveDirectionOptimizing(Maze &maze);
+
 public:
     /* -- */ BreadthFirstSearchAlgorithm();
 
     virtual ~BreadthFirstSearchAlgorithm() = default;
 
+    void setDirectionOptimizing(bool directionOptimizing);
+
+    bool getDirectionOptimizing() const;
+
+    Expected<MazePath> solve(Maze &maze) override;
+};
+
+class BidirectionalBreadthFirstSearchAlgorithm : public SolvingAlgorithm {
+public:
+    /* -- */ BidirectionalBreadthFirstSearchAlgorithm();
+
+    virtual ~BidirectionalBreadthFirstSearchAlgorithm() = default;
+
     Expected<MazePath> solve(Maze &maze) override;
 };
 
@@ -144,11 +584,60 @@ public:
     Expected<MazePath> solve(Maze &maze) override;
 };
 
+class AStarAlgorithm : public SolvingAlgorithm {
+private:
+    IndexedHeap<4> heap;
+    long long nodesExpanded = 0;
+
+public:
+    /* -- */ AStarAlgorithm();
+
+    virtual ~AStarAlgorithm() = default;
+
+    Expected<MazePath> solve(Maze &maze) override;
+
+    long long getNodesExpanded() const;
+};
+
 class DijkstraAlgorithm : public SolvingAlgorithm {
+private:
+    bool bucketQueue = true;
+    bool contraction = false;
+    IndexedHeap<2> heap;
+    BucketQueue buckets;
+
+    Expected<MazePath> solveContracted(Maze &maze);
+
 public:
     /* -- */ DijkstraAlgorithm();
 
     virtual ~DijkstraAlgorithm() = default;
 
+    void setBucketQueue(bool bucketQueue);
+
+    bool getBucketQueue() const;
+
+    void setContraction(bool contraction);
+
+    bool getContraction() const;
+
     Expected<MazePath> solve(Maze &maze) override;
 };
+
+class DeadEndFillingAlgorithm : public SolvingAlgorithm {
+private:
+    int threads = 0;
+    std::vector<std::atomic<uint8_t>> degrees;
+    IndexedHeap<2> heap;
+
+public:
+    /* -- */ DeadEndFillingAlgorithm();
+
+    virtual ~DeadEndFillingAlgorithm() = default;
+
+    void setThreads(int threads);
+
+    int getThreads() const;
+
+    Expected<MazePath> solve(Maze &maze) override;
+};
\ No newline at end of file
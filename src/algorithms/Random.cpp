@@ -0,0 +1,71 @@
+#include "Random.h"
+
+/**
+ * @brief Advance a splitmix64 state and return its next output
+ * @param value state to advance
+ * @return next output
+ */
+static uint64_t splitMix(uint64_t &value) {
+    uint64_t result = (value += 0x9E3779B97F4A7C15ULL);
+    result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    result = (result ^ (result >> 27)) * 0x94D049BB133111EBULL;
+    return result ^ (result >> 31);
+}
+
+/**
+ * @brief Construct a new Random:: Random object
+ * @param seed seed of the generator
+ */
+Random::Random(uint64_t seed) {
+    this->setSeed(seed);
+}
+
+/**
+ * @brief Construct a new Random:: Random object on an independent stream
+ * @param seed seed shared by all streams
+ * @param stream number of the stream
+ */
+Random::Random(uint64_t seed, uint64_t stream) {
+    this->setSeed(seed, stream);
+}
+
+/**
+ * @brief Reseed the generator
+ * @param seed seed of the generator
+ */
+void Random::setSeed(uint64_t seed) {
+    for (uint64_t &word: this->state) {
+        word = splitMix(seed);
+    }
+}
+
+/**
+ * @brief Reseed the generator on an independent stream of the seed
+ * @param seed seed shared by all streams
+ * @param stream number of the stream
+ */
+void Random::setSeed(uint64_t seed, uint64_t stream) {
+    uint64_t mixed = stream;
+    this->setSeed(seed ^ splitMix(mixed));
+}
+
+/**
+ * @brief Get an unbiased random number in the range 0 .. bound - 1 (Lemire's method)
+ * @param bound exclusive upper bound, must be greater than 0
+ * @return random number
+ */
+uint32_t Random::nextBounded(uint32_t bound) {
+    uint64_t product = (this->next() >> 32) * bound;
+    uint32_t low = static_cast<uint32_t>(product);
+
+    if (low < bound) {
+        uint32_t threshold = (0u - bound) % bound;
+
+        while (low < threshold) {
+            product = (this->next() >> 32) * bound;
+            low = static_cast<uint32_t>(product);
+        }
+    }
+
+    return static_cast<uint32_t>(product >> 32);
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Seeded pseudo random number generator (xoshiro256**) owned by each algorithm instance.
+ *
+ * The state is expanded from a 64-bit seed with splitmix64. Independent streams, for example one per
+ * thread or per tile, are derived from the same seed by a stream number. The class satisfies the
+ * UniformRandomBitGenerator requirements, so it can drive std::shuffle and the std distributions.
+ */
+class Random {
+private:
+    uint64_t state[4];
+
+    static uint64_t rotate(uint64_t value, int shift) {
+        return (value << shift) | (value >> (64 - shift));
+    }
+
+public:
+    typedef uint64_t result_type;
+
+    explicit Random(uint64_t seed = 0);
+
+    Random(uint64_t seed, uint64_t stream);
+
+    ~Random() = default;
+
+    void setSeed(uint64_t seed);
+
+    void setSeed(uint64_t seed, uint64_t stream);
+
+    static constexpr result_type min() { return 0; }
+
+    static constexpr result_type max() { return std::numeric_limits<uint64_t>::max(); }
+
+    uint64_t next() {
+        uint64_t result = Random::rotate(this->state[1] * 5, 7) * 9;
+        uint64_t shifted = this->state[1] << 17;
+
+        this->state[2] ^= this->state[0];
+        this->state[3] ^= this->state[1];
+        this->state[1] ^= this->state[2];
+        this->state[0] ^= this->state[3];
+        this->state[2] ^= shifted;
+        this->state[3] = Random::rotate(this->state[3], 45);
+
+        return result;
+    }
+
+    result_type operator()() {
+        return this->next();
+    }
+
+    uint32_t nextBounded(uint32_t bound);
+
+    bool nextBool() {
+        return this->next() >> 63;
+    }
+};
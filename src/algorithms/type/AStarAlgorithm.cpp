@@ -0,0 +1,124 @@
+#include "../Algorithm.h"
+
+using namespace std;
+
+#define DESCRIPTION "A* Algorithm is an informed shortest path search. Like Dijkstra's algorithm it settles cells in order of a cost, but the cost of a cell is its distance from the start plus an estimate of its distance to the end. The estimate is the Manhattan distance on the grid times the lowest passage weight, which never overestimates, so the path found is the shortest one. Cells towards the end are expanded first, which on open mazes with loops explores far fewer cells than breadth-first search. The open list is an indexed 4-ary heap."
+#define COMPLEXITY "O((V+E)logV)"
+
+AStarAlgorithm::AStarAlgorithm() : SolvingAlgorithm("AStarAlgorithm") {
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+Expected<MazePath> AStarAlgorithm::solve(Maze &maze) {
+    if (maze.isValid().hasError()) return Expected<MazePath>(maze.isValid().errors());
+
+    vector<Node> path;
+
+    shared_ptr<Graph> graph = maze.getGraph();
+    shared_ptr<Adjacency> adjacency = maze.getAdjacency();
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    const vector<uint32_t> &offsets = adjacency->getOffsets();
+    const vector<uint32_t> &targets = adjacency->getTargets();
+    const vector<uint8_t> &weights = adjacency->getWeights();
+    bool weighted = adjacency->isWeighted();
+    uint32_t minWeight = static_cast<uint32_t>(adjacency->getMinWeight());
+    int width = graph->getWidth();
+
+    // Reset the IDs of the path, marks are 0 for unseen, 1 for open and 2 for closed cells
+    this->scratch.reset(graph->size());
+    this->heap.reset(graph->size());
+    this->nodesExpanded = 0;
+
+    // Get start and end node
+    int start = graph->getIndex(graph->getNode(maze.getStart()));
+    int end = graph->getIndex(graph->getNode(maze.getEnd()));
+    int endX = end % width;
+    int endY = end / width;
+
+    // Lower bound on the cost from the cell to the end
+    auto estimate = [&](uint32_t cell) {
+        int x = static_cast<int>(cell % width);
+        int y = static_cast<int>(cell / width);
+
+        return static_cast<uint32_t>(abs(x - endX) + abs(y - endY)) * minWeight;
+    };
+
+    // Heap key, distance plus estimate in the high bits and the estimate in the low 20 bits, so ties are
+    // broken towards the end. Keys in the heap stay within two passage weights of each other, the wrapped
+    // key comparison of the heap still holds.
+    auto getKey = [&](uint32_t distance, uint32_t remaining) {
+        return ((distance + remaining) << 20) + std::min(remaining, 0xFFFFFu);
+    };
+
+    // Distances from the start are kept modulo 2^32 like in Dijkstra's algorithm
+    this->scratch.setDistance(start, 0);
+    this->scratch.setMark(start, 1);
+    this->heap.push(start, getKey(0, estimate(start)));
+
+    int current = -1;
+
+    while (!this->heap.empty()) {
+        uint32_t key;
+        uint32_t cell = this->heap.pop(key);
+
+        this->scratch.setMark(cell, 2);
+        this->nodesExpanded++;
+
+        if (static_cast<int>(cell) == end) {
+            current = end;
+            break;
+        }
+
+        uint32_t distance = static_cast<uint32_t>(this->scratch.getDistance(cell));
+
+        // The estimate is consistent, so closed cells never need to be opened again
+        for (uint32_t i = offsets[cell]; i < offsets[cell + 1]; i++) {
+            uint32_t neighbour = targets[i];
+            int mark = this->scratch.getMark(neighbour);
+
+            if (mark == 2) {
+                continue;
+            }
+
+            uint32_t candidate = distance + (weighted ? weights[i] : 1);
+            uint32_t known = static_cast<uint32_t>(this->scratch.getDistance(neighbour));
+
+            if (mark == 1 && static_cast<int32_t>(candidate - known) >= 0) {
+                continue;
+            }
+
+            this->scratch.setDistance(neighbour, static_cast<int>(candidate));
+            this->scratch.setParent(neighbour, static_cast<int>(cell));
+            this->scratch.setMark(neighbour, 1);
+            this->heap.push(neighbour, getKey(candidate, estimate(neighbour)));
+        }
+    }
+
+    if (current == -1) {
+        return Expected<MazePath>("No path found");
+    }
+
+    // Reconstruct the path
+    while (current != -1) {
+        path.push_back(graph->getNode(current));
+        current = this->scratch.getParent(current);
+    }
+
+    // Reverse the path
+    std::reverse(path.begin(), path.end());
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    return Expected(MazePath(duration, this->getName(), graph, path));
+}
+
+/**
+ * Get number of cells expanded by the last solve
+ * @return number of expanded cells
+ */
+long long AStarAlgorithm::getNodesExpanded() const {
+    return this->nodesExpanded;
+}
@@ -0,0 +1,112 @@
+#include "../Algorithm.h"
+
+using namespace std;
+
+#define DESCRIPTION "Bidirectional Breadth-First Search runs two breadth-first searches at the same time, one from the start and one from the end, and always expands a whole level of the smaller frontier. The search stops when the frontiers meet and the path is joined at the meeting passage. Both searches only reach about half the distance, so on large mazes with distant endpoints it explores far fewer cells than a single breadth-first search, and the path is just as short."
+#define COMPLEXITY "O(|V| + |E|)"
+
+// Marks of the cells reached from the start and from the end
+#define FORWARD 1
+#define BACKWARD 2
+
+BidirectionalBreadthFirstSearchAlgorithm::BidirectionalBreadthFirstSearchAlgorithm()
+        : SolvingAlgorithm("BidirectionalBreadthFirstSearch") {
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+Expected<MazePath> BidirectionalBreadthFirstSearchAlgorithm::solve(Maze &maze) {
+    if (maze.isValid().hasError()) return Expected<MazePath>(maze.isValid().errors());
+
+    vector<Node> path;
+
+    shared_ptr<Graph> graph = maze.getGraph();
+    shared_ptr<Adjacency> adjacency = maze.getAdjacency();
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    const vector<uint32_t> &offsets = adjacency->getOffsets();
+    const vector<uint32_t> &targets = adjacency->getTargets();
+    int size = graph->size();
+
+    // Reset the IDs of the path, marks tell the side, distances the level and parents point towards its root
+    this->scratch.reset(size);
+
+    // Flat queues, the forward one in [0, size) and the backward one in [size, 2 * size)
+    vector<int> &queue = this->scratch.getBuffer();
+    if (static_cast<int>(queue.size()) < 2 * size) queue.resize(2 * size);
+
+    int head[2] = {0, size};
+    int tail[2] = {0, size};
+
+    // Get start and end node
+    int start = graph->getIndex(graph->getNode(maze.getStart()));
+    int end = graph->getIndex(graph->getNode(maze.getEnd()));
+
+    this->scratch.setMark(start, FORWARD);
+    this->scratch.setDistance(start, 0);
+    queue[tail[0]++] = start;
+
+    if (end != start) {
+        this->scratch.setMark(end, BACKWARD);
+        this->scratch.setDistance(end, 0);
+        queue[tail[1]++] = end;
+    }
+
+    // Meeting passage, from a forward cell to a backward cell
+    int meetForward = end == start ? start : -1;
+    int meetBackward = end == start ? start : -1;
+
+    while (meetForward == -1 && head[0] < tail[0] && head[1] < tail[1]) {
+
+        // Expand a whole level of the smaller frontier
+        int side = tail[0] - head[0] <= tail[1] - head[1] ? 0 : 1;
+        int mark = side == 0 ? FORWARD : BACKWARD;
+        int other = side == 0 ? BACKWARD : FORWARD;
+        int levelEnd = tail[side];
+        int best = std::numeric_limits<int>::max();
+
+        while (head[side] < levelEnd) {
+            int current = queue[head[side]++];
+
+            for (uint32_t i = offsets[current]; i < offsets[current + 1]; i++) {
+                int neighbour = static_cast<int>(targets[i]);
+                int neighbourMark = this->scratch.getMark(neighbour);
+
+                if (neighbourMark == 0) {
+                    this->scratch.setMark(neighbour, mark);
+                    this->scratch.setDistance(neighbour, this->scratch.getDistance(current) + 1);
+                    this->scratch.setParent(neighbour, current);
+                    queue[tail[side]++] = neighbour;
+                } else if (neighbourMark == other && this->scratch.getDistance(neighbour) < best) {
+
+                    // Frontiers met, the rest of the level is still scanned for a shorter meeting
+                    best = this->scratch.getDistance(neighbour);
+                    meetForward = side == 0 ? current : neighbour;
+                    meetBackward = side == 0 ? neighbour : current;
+                }
+            }
+        }
+    }
+
+    if (meetForward == -1) {
+        return Expected<MazePath>("No path found");
+    }
+
+    // Forward half from the start to the meeting passage, then the backward half up to the end
+    for (int current = meetForward; current != -1; current = this->scratch.getParent(current)) {
+        path.push_back(graph->getNode(current));
+    }
+
+    reverse(path.begin(), path.end());
+
+    if (meetBackward != meetForward) {
+        for (int current = meetBackward; current != -1; current = this->scratch.getParent(current)) {
+            path.push_back(graph->getNode(current));
+        }
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    return Expected(MazePath(duration, this->getName(), graph, path));
+}
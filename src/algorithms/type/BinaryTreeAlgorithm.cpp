@@ -0,0 +1,81 @@
+#include "../Algorithm.h"
+
+using namespace std;
+
+#define DESCRIPTION "Binary Tree Algorithm opens either the east or the south wall of every cell, chosen at random. Cells in the last column always open south and cells in the last row always open east. Every cell is decided independently, so 64 cells are carved at once from a single random word and rows are split between threads. The mazes have a strong diagonal bias and two long corridors along the east and south edges."
+#define COMPLEXITY "O(V)"
+
+/**
+ * @brief Construct a new Binary Tree Algorithm:: Binary Tree Algorithm object
+ */
+BinaryTreeAlgorithm::BinaryTreeAlgorithm() : GeneratingAlgorithm("BinaryTree", 0) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * @brief Construct a new Binary Tree Algorithm:: Binary Tree Algorithm object
+ * @param seed seed of the algorithm
+ */
+BinaryTreeAlgorithm::BinaryTreeAlgorithm(unsigned int seed) : GeneratingAlgorithm("BinaryTree", seed) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * Generate a maze using the Binary Tree algorithm, one word of 64 cells at a time
+ * @param width width of the maze
+ * @param height height of the maze
+ * @return MazeBuilder object
+ */
+Expected<MazeBuilder> BinaryTreeAlgorithm::generate(int width, int height) {
+    if (this->seed <= 0) return Expected<MazeBuilder>("Seed must be greater than 0");
+    if (width < 2 || height < 2) return Expected<MazeBuilder>("Width and height must be greater than 1");
+
+    std::shared_ptr<Graph> graph = std::make_shared<Graph>(width, height);
+    Grid &grid = graph->getGrid();
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    int rowWords = grid.getRowWords();
+
+    // Cells of the last word, and the east wall of the last column which has to stay closed
+    uint64_t lastCells = width % 64 == 0 ? ~uint64_t(0) : (uint64_t(1) << (width % 64)) - 1;
+    uint64_t lastColumn = uint64_t(1) << ((width - 1) % 64);
+
+    // Workers write whole rows through the raw accessors, the grid changes once for the whole maze
+    grid.bumpVersion();
+
+    this->forEachRow(height, [&](int y) {
+        uint64_t *east = grid.rawEastRow(y);
+        uint64_t *south = grid.rawSouthRow(y);
+
+        // Every row has its own random stream, so the maze does not depend on the number of threads
+        Random random(this->seed, y);
+
+        for (int word = 0; word < rowWords; word++) {
+            uint64_t cells = word == rowWords - 1 ? lastCells : ~uint64_t(0);
+            uint64_t eastCells = word == rowWords - 1 ? cells & ~lastColumn : cells;
+
+            if (y == height - 1) {
+                east[word] = eastCells;
+                south[word] = 0;
+            } else {
+                east[word] = random.next() & eastCells;
+                south[word] = ~east[word] & cells;
+            }
+        }
+    });
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    return Expected<MazeBuilder>(MazeBuilder(width, height, duration, this->getName(), seed, graph));
+}
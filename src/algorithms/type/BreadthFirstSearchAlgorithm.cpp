@@ -2,7 +2,7 @@
 
 using namespace std;
 
-#define DESCRIPTION "Breadth-first search (BFS) is an algorithm for traversing or searching tree or graph data structures. It starts at the tree root (or some arbitrary node of a graph, sometimes referred to as a 'search key'[1]), and explores all of the neighbor nodes at the present depth prior to moving on to the nodes at the next depth level. "
+#define DESCRIPTION "Breadth-first search (BFS) is an algorithm for traversing or searching tree or graph data structures. It starts at the tree root (or some arbitrary node of a graph, sometimes referred to as a 'search key'[1]), and explores all of the neighbor nodes at the present depth prior to moving on to the nodes at the next depth level. With direction optimization the visited cells and the frontier are kept as bitmaps, and large frontiers are expanded bottom-up by word operations on 64 cells at once."
 #define COMPLEXITY "O(|V| + |E|)"
 
 BreadthFirstSearchAlgorithm::BreadthFirstSearchAlgorithm() : SolvingAlgorithm("BreadthFirstSearch") {
@@ -10,71 +10,328 @@ BreadthFirstSearchAlgorithm::BreadthFirstSearchAlgorithm() : SolvingAlgorithm("B
     this->complexity = COMPLEXITY;
 }
 
+/**
+ * Sets whether the search keeps its frontiers as bitmaps and switches to bottom-up steps on large frontiers
+ * @param directionOptimizing true for the direction-optimizing search, false for the queue
+ */
+void BreadthFirstSearchAlgorithm::setDirectionOptimizing(bool directionOptimizing) {
+    this->directionOptimizing = directionOptimizing;
+}
+
+/**
+ * Returns whether the search keeps its frontiers as bitmaps and switches to bottom-up steps on large frontiers
+ * @return true for the direction-optimizing search, false for the queue
+ */
+bool BreadthFirstSearchAlgorithm::getDirectionOptimizing() const {
+    return this->directionOptimizing;
+}
+
 Expected<MazePath> BreadthFirstSearchAlgorithm::solve(Maze &maze) {
     if (maze.isValid().hasError()) return Expected<MazePath>(maze.isValid().errors());
+    if (this->directionOptimizing) return this->solveDirectionOptimizing(maze);
 
-    queue<shared_ptr<Node>> queue;
-    vector<shared_ptr<Node>> path;
+    vector<Node> path;
 
-    Graph graph = maze.getGraph()->clone();
+    shared_ptr<Graph> graph = maze.getGraph();
+    shared_ptr<Adjacency> adjacency = maze.getAdjacency();
     auto startTime = std::chrono::high_resolution_clock::now();
 
-    // Set the IDs of the path
-    for (const auto &node: graph.getNodes()) {
-        node->setID(0);
-    }
+    const vector<uint32_t> &offsets = adjacency->getOffsets();
+    const vector<uint32_t> &targets = adjacency->getTargets();
+
+    // Reset the IDs of the path
+    this->scratch.reset(graph->size());
+
+    // Flat queue, every cell is enqueued at most once
+    vector<int> &queue = this->scratch.getBuffer();
+    if (static_cast<int>(queue.size()) < graph->size()) queue.resize(graph->size());
+    int head = 0;
+    int tail = 0;
 
     // Get start and end node
-    shared_ptr<Node> startNode = graph.getNode(maze.getStart());
-    shared_ptr<Node> endNode = graph.getNode(maze.getEnd());
+    int start = graph->getIndex(graph->getNode(maze.getStart()));
+    int end = graph->getIndex(graph->getNode(maze.getEnd()));
 
     // Set start as visited
-    shared_ptr<Node> currentNode = startNode;
-    startNode->setID(0);
-    queue.push(startNode);
+    int current = start;
+    this->scratch.setMark(start, 0);
+    queue[tail++] = start;
 
     // Iterate through the queue until path is found
-    while (!queue.empty()) {
-        currentNode = queue.front();
-        queue.pop();
+    while (head < tail) {
+        current = queue[head++];
 
         // Increase ID
-        currentNode->setID(currentNode->getID() + 1);
+        this->scratch.setMark(current, this->scratch.getMark(current) + 1);
 
         // If end is found, reconstruct path
-        if (currentNode->getX() == endNode->getX() && currentNode->getY() == endNode->getY()) {
+        if (current == end) {
             break;
         }
 
         // Try to find a neighbour that is not visited
-        for (const auto &neighbor: currentNode->getNeighbours()) {
-            if (neighbor->getID() == 0) {
-                neighbor->setID(currentNode->getID());
-                queue.push(neighbor);
+        for (uint32_t i = offsets[current]; i < offsets[current + 1]; i++) {
+            uint32_t neighbour = targets[i];
+
+            if (this->scratch.getMark(neighbour) == 0) {
+                this->scratch.setMark(neighbour, this->scratch.getMark(current));
+                queue[tail++] = static_cast<int>(neighbour);
+            }
+        }
+    }
+
+    if (current == start) {
+        return Expected<MazePath>("No path found");
+    }
+
+    while (this->scratch.getMark(current) > 1) {
+        path.push_back(graph->getNode(current));
+
+        for (uint32_t i = offsets[current]; i < offsets[current + 1]; i++) {
+            uint32_t neighbour = targets[i];
+
+            if (this->scratch.getMark(neighbour) == this->scratch.getMark(current) - 1) {
+                current = static_cast<int>(neighbour);
+                break;
+            }
+        }
+    }
+
+    path.push_back(graph->getNode(start));
+    reverse(path.begin(), path.end());
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    return Expected(MazePath(duration, this->getName(), graph, path));
+}
+
+/**
+ * Solve the maze level by level with bitmaps of the visited cells and of the frontier. A cell is addressed by
+ * its bit in the row layout of the grid, bit x % 64 of word y * rowWords + x / 64, and the walls are copied into
+ * the same layout, so neighbours are found by adding to the position without any division.
+ * Small frontiers are expanded top-down from a list of cells. Once the frontier outnumbers the words of the rows
+ * it spans, every unvisited cell of those rows is checked bottom-up at once, 64 cells per word, by shifting the
+ * frontier words along the open east and south walls.
+ * @param maze maze to solve
+ * @return path from start to end
+ */
+Expected<MazePath> BreadthFirstSearchAlgorithm::solveDirectionOptimizing(Maze &maze) {
+    vector<Node> path;
+
+    shared_ptr<Graph> graph = maze.getGraph();
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    const Grid &grid = std::as_const(*graph).getGrid();
+    int height = grid.getHeight();
+    int rowWords = grid.getRowWords();
+    int stride = rowWords * 64;
+    size_t words = static_cast<size_t>(rowWords) * height;
+
+    this->eastWalls.resize(words);
+    this->southWalls.resize(words);
+
+    // Keep only passages to cells inside the maze: bits past the last column, the east bit of the last column
+    // and the south bits of the last row are cleared, whatever the grid holds
+    int width = grid.getWidth();
+    uint64_t lastCells = width % 64 == 0 ? ~uint64_t(0) : (uint64_t(1) << (width % 64)) - 1;
+    uint64_t lastColumn = uint64_t(1) << ((width - 1) % 64);
+
+    for (int y = 0; y < height; y++) {
+        uint64_t *eastRow = this->eastWalls.data() + static_cast<size_t>(y) * rowWords;
+        uint64_t *southRow = this->southWalls.data() + static_cast<size_t>(y) * rowWords;
+
+        std::copy_n(grid.getEastRow(y), rowWords, eastRow);
+        eastRow[rowWords - 1] &= lastCells & ~lastColumn;
+
+        if (y < height - 1) {
+            std::copy_n(grid.getSouthRow(y), rowWords, southRow);
+            southRow[rowWords - 1] &= lastCells;
+        } else {
+            std::fill_n(southRow, rowWords, 0);
+        }
+    }
+
+    const uint64_t *east = this->eastWalls.data();
+    const uint64_t *south = this->southWalls.data();
+
+    this->visited.assign(words, 0);
+    this->frontier.assign(words, 0);
+    this->next.assign(words, 0);
+    uint64_t *visited = this->visited.data();
+    vector<uint64_t> zeros(rowWords, 0);
+
+    // Level of every visited cell, a level is only read after the visited bit is set so it needs no reset
+    if (this->levels.size() < words * 64) this->levels.resize(words * 64);
+    uint32_t *levels = this->levels.data();
+
+    auto isVisited = [&](int position) {
+        return (visited[position / 64] >> (position % 64)) & 1;
+    };
+
+    // Flat list of the top-down frontiers, every cell is listed at most once
+    vector<int> &queue = this->scratch.getBuffer();
+    if (static_cast<int>(queue.size()) < graph->size()) queue.resize(graph->size());
+    int head = 0;
+    int tail = 0;
+
+    // Get start and end position
+    Node startNode = graph->getNode(maze.getStart());
+    Node endNode = graph->getNode(maze.getEnd());
+    int start = startNode.getY() * stride + startNode.getX();
+    int end = endNode.getY() * stride + endNode.getX();
+
+    visited[start / 64] |= uint64_t(1) << (start % 64);
+    levels[start] = 1;
+    queue[tail++] = start;
+
+    // Size of the frontier and the band of rows it spans
+    long long count = 1;
+    int top = startNode.getY();
+    int bottom = top;
+    uint32_t level = 1;
+    bool bottomUp = false;
+
+    while (count > 0 && !isVisited(end)) {
+        level++;
+
+        // A bottom-up step costs a few operations per word of the band, a top-down step a few per frontier cell
+        long long bandWords = static_cast<long long>(std::min(height, bottom - top + 3)) * rowWords;
+        bool wantBottomUp = count > bandWords;
+
+        if (wantBottomUp && !bottomUp) {
+            for (; head < tail; head++) {
+                this->frontier[queue[head] / 64] |= uint64_t(1) << (queue[head] % 64);
+            }
+        } else if (!wantBottomUp && bottomUp) {
+            head = tail;
+
+            for (size_t word = static_cast<size_t>(top) * rowWords; word < static_cast<size_t>(bottom + 1) * rowWords; word++) {
+                for (uint64_t bits = this->frontier[word]; bits; bits &= bits - 1) {
+                    queue[tail++] = static_cast<int>(word * 64) + __builtin_ctzll(bits);
+                }
+
+                this->frontier[word] = 0;
+            }
+        }
+
+        bottomUp = wantBottomUp;
+        count = 0;
+        int firstWord = static_cast<int>(words);
+        int lastWord = -1;
+
+        if (!bottomUp) {
+            int levelEnd = tail;
+
+            auto visit = [&](int position) {
+                uint64_t &word = visited[position / 64];
+                uint64_t mask = uint64_t(1) << (position % 64);
+
+                if (word & mask) {
+                    return;
+                }
+
+                word |= mask;
+                levels[position] = level;
+                queue[tail++] = position;
+                count++;
+
+                firstWord = std::min(firstWord, position / 64);
+                lastWord = std::max(lastWord, position / 64);
+            };
+
+            // The east bit of the last column is cleared, so the west neighbour of the first column is never open
+            for (; head < levelEnd; head++) {
+                int current = queue[head];
+
+                if ((east[current / 64] >> (current % 64)) & 1) visit(current + 1);
+                if ((south[current / 64] >> (current % 64)) & 1) visit(current + stride);
+                if (current > 0 && ((east[(current - 1) / 64] >> ((current - 1) % 64)) & 1)) visit(current - 1);
+                if (current >= stride && ((south[(current - stride) / 64] >> (current % 64)) & 1)) visit(current - stride);
             }
+        } else {
+            for (int y = std::max(0, top - 1); y <= std::min(height - 1, bottom + 1); y++) {
+                size_t offset = static_cast<size_t>(y) * rowWords;
+                const uint64_t *row = this->frontier.data() + offset;
+                const uint64_t *up = y > 0 ? row - rowWords : zeros.data();
+                const uint64_t *upSouth = y > 0 ? south + offset - rowWords : zeros.data();
+                const uint64_t *down = y < height - 1 ? row + rowWords : zeros.data();
+                const uint64_t *eastRow = east + offset;
+                const uint64_t *southRow = south + offset;
+                uint64_t *visitedRow = visited + offset;
+                uint64_t *nextRow = this->next.data() + offset;
+
+                // Frontier cells reach their east neighbour through their own east bit, and their west
+                // neighbour through its east bit, the bit carried between words is the last column of a word
+                uint64_t carry = 0;
+
+                for (int k = 0; k < rowWords; k++) {
+                    uint64_t eastward = row[k] & eastRow[k];
+                    uint64_t following = k + 1 < rowWords ? row[k + 1] : 0;
+
+                    uint64_t reached = (eastward << 1 | carry) | ((row[k] >> 1 | following << 63) & eastRow[k])
+                                       | (up[k] & upSouth[k]) | (down[k] & southRow[k]);
+                    reached &= ~visitedRow[k];
+                    carry = eastward >> 63;
+
+                    if (reached == 0) {
+                        continue;
+                    }
+
+                    nextRow[k] = reached;
+                    visitedRow[k] |= reached;
+                    count += __builtin_popcountll(reached);
+
+                    firstWord = std::min(firstWord, static_cast<int>(offset) + k);
+                    lastWord = std::max(lastWord, static_cast<int>(offset) + k);
+
+                    for (uint64_t bits = reached; bits; bits &= bits - 1) {
+                        levels[(offset + k) * 64 + __builtin_ctzll(bits)] = level;
+                    }
+                }
+            }
+
+            // Clear the current frontier, it becomes the empty next frontier
+            std::fill(this->frontier.begin() + static_cast<size_t>(top) * rowWords,
+                      this->frontier.begin() + static_cast<size_t>(bottom + 1) * rowWords, 0);
+
+            this->frontier.swap(this->next);
         }
+
+        top = firstWord / rowWords;
+        bottom = lastWord / rowWords;
     }
 
-    if (currentNode == startNode) {
+    if (!isVisited(end)) {
         return Expected<MazePath>("No path found");
     }
 
-    while (currentNode->getID() > 1) {
-        path.push_back(currentNode);
+    // Step back through the open neighbours one level lower
+    int current = end;
+
+    while (levels[current] > 1) {
+        path.push_back(graph->getNode(current % stride, current / stride));
+
+        int neighbours[4] = {
+                (east[current / 64] >> (current % 64)) & 1 ? current + 1 : -1,
+                (south[current / 64] >> (current % 64)) & 1 ? current + stride : -1,
+                current > 0 && ((east[(current - 1) / 64] >> ((current - 1) % 64)) & 1) ? current - 1 : -1,
+                current >= stride && ((south[(current - stride) / 64] >> (current % 64)) & 1) ? current - stride : -1
+        };
 
-        for (const auto &neighbor: currentNode->getNeighbours()) {
-            if (neighbor->getID() == currentNode->getID() - 1) {
-                currentNode = neighbor;
+        for (int neighbour: neighbours) {
+            if (neighbour >= 0 && isVisited(neighbour) && levels[neighbour] == levels[current] - 1) {
+                current = neighbour;
                 break;
             }
         }
     }
 
-    path.push_back(startNode);
+    path.push_back(graph->getNode(current % stride, current / stride));
     reverse(path.begin(), path.end());
 
     auto endTime = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
 
-    return Expected(MazePath(duration, this->getName(), path));
+    return Expected(MazePath(duration, this->getName(), graph, path));
 }
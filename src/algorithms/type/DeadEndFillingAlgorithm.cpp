@@ -0,0 +1,217 @@
+#include "../Algorithm.h"
+
+using namespace std;
+
+#define DESCRIPTION "Dead-end filling removes every dead end of the maze, a cell with a single open neighbour other than the start and the end, and keeps removing the cells behind it which become dead ends, until no dead end is left. In a perfect maze only the solution corridor remains, in a maze with loops the remaining cells hold every path between start and end and the shortest of them is taken, by breadth-first search or, on weighted mazes, by Dijkstra's algorithm over the remaining cells. The work does not depend on where start and end are. On large mazes worker threads scan disjoint stripes of rows and remove dead ends through an atomic degree array, so no frontier queue is needed."
+#define COMPLEXITY "O(V)"
+
+// Degree flag of removed cells
+#define REMOVED 0x80
+
+// Mazes with fewer cells are filled on the calling thread, starting the workers costs more than it saves
+#define PARALLEL_CELLS 65536
+
+DeadEndFillingAlgorithm::DeadEndFillingAlgorithm() : SolvingAlgorithm("DeadEndFilling") {
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * Sets the number of worker threads which fill the dead ends
+ * @param threads number of threads, 0 or less to use all hardware threads
+ */
+void DeadEndFillingAlgorithm::setThreads(int threads) {
+    this->threads = threads;
+}
+
+/**
+ * Returns the number of worker threads which fill the dead ends
+ * @return number of threads, at least 1
+ */
+int DeadEndFillingAlgorithm::getThreads() const {
+    if (this->threads > 0) {
+        return this->threads;
+    }
+
+    return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+Expected<MazePath> DeadEndFillingAlgorithm::solve(Maze &maze) {
+    if (maze.isValid().hasError()) return Expected<MazePath>(maze.isValid().errors());
+
+    vector<Node> path;
+
+    shared_ptr<Graph> graph = maze.getGraph();
+    shared_ptr<Adjacency> adjacency = maze.getAdjacency();
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    const vector<uint32_t> &offsets = adjacency->getOffsets();
+    const vector<uint32_t> &targets = adjacency->getTargets();
+    const vector<uint8_t> &weights = adjacency->getWeights();
+    bool weighted = adjacency->isWeighted();
+
+    int size = graph->size();
+    int width = graph->getWidth();
+    int height = graph->getHeight();
+    int threads = size < PARALLEL_CELLS ? 1 : this->getThreads();
+
+    if (static_cast<int>(this->degrees.size()) != size) {
+        vector<atomic<uint8_t>>(size).swap(this->degrees);
+    }
+
+    // Get start and end node
+    uint32_t start = graph->getIndex(graph->getNode(maze.getStart()));
+    uint32_t end = graph->getIndex(graph->getNode(maze.getEnd()));
+
+    // Stripes of whole rows, a few per thread so that the uneven ones are balanced. The kernel is a template
+    // argument of the lambda, so it is inlined into the loop over the cells of a stripe.
+    int stripes = std::min(height, threads * 4);
+
+    auto forEachStripe = [&](auto &&kernel) {
+        if (threads == 1) {
+            for (uint32_t cell = 0; cell < static_cast<uint32_t>(size); cell++) {
+                kernel(cell);
+            }
+
+            return;
+        }
+
+        Algorithm::forEachTask(stripes, threads, [&](int stripe) {
+            uint32_t first = static_cast<uint32_t>(width * (height * stripe / stripes));
+            uint32_t last = static_cast<uint32_t>(width * (height * (stripe + 1) / stripes));
+
+            for (uint32_t cell = first; cell < last; cell++) {
+                kernel(cell);
+            }
+        });
+    };
+
+    forEachStripe([&](uint32_t cell) {
+        this->degrees[cell].store(static_cast<uint8_t>(offsets[cell + 1] - offsets[cell]), std::memory_order_relaxed);
+    });
+
+    // Remove a dead end and follow the corridor behind it while its next cell becomes a dead end. Only the
+    // thread whose exchange succeeds removes a cell, and only the one which dropped a degree to 1 follows it.
+    auto fill = [&](uint32_t cell) {
+        while (cell != start && cell != end) {
+            uint8_t expected = 1;
+
+            if (!this->degrees[cell].compare_exchange_strong(expected, REMOVED)) {
+                return;
+            }
+
+            uint32_t next = start;
+
+            for (uint32_t i = offsets[cell]; i < offsets[cell + 1]; i++) {
+                uint32_t neighbour = targets[i];
+                uint8_t degree = this->degrees[neighbour].load();
+
+                while (!(degree & REMOVED) && !this->degrees[neighbour].compare_exchange_weak(degree, degree - 1)) {}
+
+                if (degree == 2) {
+                    next = neighbour;
+                }
+            }
+
+            cell = next;
+        }
+    };
+
+    forEachStripe([&](uint32_t cell) {
+        if (this->degrees[cell].load(std::memory_order_relaxed) == 1) {
+            fill(cell);
+        }
+    });
+
+    // Walk the remaining cells from the start, in a perfect maze they are only the solution corridor. Marks are
+    // 0 for unseen, 1 for queued and 2 for settled cells, the parents lead back to the start.
+    auto isRemaining = [&](uint32_t cell) {
+        return !(this->degrees[cell].load(std::memory_order_relaxed) & REMOVED);
+    };
+
+    this->scratch.reset(size);
+    this->scratch.setMark(start, 1);
+
+    bool found = false;
+
+    if (weighted) {
+        // Dijkstra's algorithm, distances are compared by their wrapped difference like in DijkstraAlgorithm
+        this->heap.reset(size);
+        this->scratch.setDistance(start, 0);
+        this->heap.push(start, 0);
+
+        while (!this->heap.empty()) {
+            uint32_t distance;
+            uint32_t cell = this->heap.pop(distance);
+
+            this->scratch.setMark(cell, 2);
+
+            if (cell == end) {
+                found = true;
+                break;
+            }
+
+            for (uint32_t i = offsets[cell]; i < offsets[cell + 1]; i++) {
+                uint32_t neighbour = targets[i];
+                int mark = this->scratch.getMark(neighbour);
+
+                if (mark == 2 || !isRemaining(neighbour)) {
+                    continue;
+                }
+
+                uint32_t candidate = distance + weights[i];
+                uint32_t known = static_cast<uint32_t>(this->scratch.getDistance(neighbour));
+
+                if (mark == 1 && static_cast<int32_t>(candidate - known) >= 0) {
+                    continue;
+                }
+
+                this->scratch.setDistance(neighbour, static_cast<int>(candidate));
+                this->scratch.setParent(neighbour, static_cast<int>(cell));
+                this->scratch.setMark(neighbour, 1);
+                this->heap.push(neighbour, candidate);
+            }
+        }
+    } else {
+        vector<int> &queue = this->scratch.getBuffer();
+        if (static_cast<int>(queue.size()) < size) queue.resize(size);
+        int head = 0;
+        int tail = 0;
+
+        queue[tail++] = static_cast<int>(start);
+
+        while (head < tail) {
+            uint32_t cell = queue[head++];
+
+            if (cell == end) {
+                found = true;
+                break;
+            }
+
+            for (uint32_t i = offsets[cell]; i < offsets[cell + 1]; i++) {
+                uint32_t neighbour = targets[i];
+
+                if (isRemaining(neighbour) && this->scratch.getMark(neighbour) == 0) {
+                    this->scratch.setMark(neighbour, 1);
+                    this->scratch.setParent(neighbour, static_cast<int>(cell));
+                    queue[tail++] = static_cast<int>(neighbour);
+                }
+            }
+        }
+    }
+
+    if (!found) {
+        return Expected<MazePath>("No path found");
+    }
+
+    for (int current = static_cast<int>(end); current != -1; current = this->scratch.getParent(current)) {
+        path.push_back(graph->getNode(current));
+    }
+
+    reverse(path.begin(), path.end());
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    return Expected(MazePath(duration, this->getName(), graph, path));
+}
@@ -13,41 +13,46 @@ DepthFirstSearchAlgorithm::DepthFirstSearchAlgorithm() : SolvingAlgorithm("Depth
 Expected<MazePath> DepthFirstSearchAlgorithm::solve(Maze &maze) {
     if (maze.isValid().hasError()) return Expected<MazePath>(maze.isValid().errors());
 
-    stack<shared_ptr<Node>> stack;
-    vector<shared_ptr<Node>> path;
+    vector<Node> path;
 
-    Graph graph = maze.getGraph()->clone();
+    shared_ptr<Graph> graph = maze.getGraph();
+    shared_ptr<Adjacency> adjacency = maze.getAdjacency();
     auto startTime = std::chrono::high_resolution_clock::now();
 
-    // Set the IDs of the path
-    for (const auto &node: graph.getNodes()) {
-        node->setID(0);
-    }
+    const vector<uint32_t> &offsets = adjacency->getOffsets();
+    const vector<uint32_t> &targets = adjacency->getTargets();
+
+    // Reset the IDs of the path
+    this->scratch.reset(graph->size());
+
+    vector<int> &stack = this->scratch.getBuffer();
+    stack.clear();
 
     // Get start and end node
-    shared_ptr<Node> startNode = graph.getNode(maze.getStart());
-    shared_ptr<Node> endNode = graph.getNode(maze.getEnd());
+    int start = graph->getIndex(graph->getNode(maze.getStart()));
+    int end = graph->getIndex(graph->getNode(maze.getEnd()));
 
     // Set start as visited
-    shared_ptr<Node> currentNode = startNode;
-    stack.push(startNode);
-    startNode->setID(1);
+    stack.push_back(start);
+    this->scratch.setMark(start, 1);
 
     // Iterate through the stack until path is found
     while (!stack.empty()) {
-        shared_ptr<Node> currentNode = stack.top();
+        int current = stack.back();
 
         // If end is found, reconstruct path
-        if (currentNode->getX() == endNode->getX() && currentNode->getY() == endNode->getY()) {
+        if (current == end) {
             break;
         }
 
         // Try to find a neighbour that is not visited
         bool found = false;
-        for (const auto &neighbor: currentNode->getNeighbours()) {
-            if (neighbor->getID() == 0) {
-                neighbor->setID(1);
-                stack.push(neighbor);
+        for (uint32_t i = offsets[current]; i < offsets[current + 1]; i++) {
+            uint32_t neighbour = targets[i];
+
+            if (this->scratch.getMark(neighbour) == 0) {
+                this->scratch.setMark(neighbour, 1);
+                stack.push_back(static_cast<int>(neighbour));
                 found = true;
                 break;
             }
@@ -55,7 +60,7 @@ Expected<MazePath> DepthFirstSearchAlgorithm::solve(Maze &maze) {
 
         // If no neighbour is found, iterate backwards
         if (!found) {
-            stack.pop();
+            stack.pop_back();
         }
     }
 
@@ -63,15 +68,15 @@ Expected<MazePath> DepthFirstSearchAlgorithm::solve(Maze &maze) {
         return Expected<MazePath>("No path found");
     }
 
-    while (!stack.empty()) {
-        path.push_back(stack.top());
-        stack.pop();
-    }
+    // The stack holds the path from start to end
+    path.reserve(stack.size());
 
-    reverse(path.begin(), path.end());
+    for (int index: stack) {
+        path.push_back(graph->getNode(index));
+    }
 
     auto endTime = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
 
-    return Expected(MazePath(duration, this->getName(), path));
+    return Expected(MazePath(duration, this->getName(), graph, path));
 }
@@ -2,70 +2,142 @@
 
 using namespace std;
 
-#define DESCRIPTION "Dijkstra's maze solving algorithm uses a graph to represent a maze, where nodes are cells and edges are possible paths. The algorithm starts at the starting cell, explores neighboring cells, and selects the cell with the shortest distance. It repeats this process until the destination cell is reached or all cells have been visited. The algorithm maintains a list of unvisited cells with their distances initialized to infinity, except for the starting cell which is set to 0. The shortest path can be reconstructed by following previous cells from the destination cell back to the starting cell."
-#define COMPLEXITY "O((V+E)logV)"
+#define DESCRIPTION "Dijkstra's maze solving algorithm uses a graph to represent a maze, where nodes are cells and edges are possible paths. The algorithm starts at the starting cell, explores neighboring cells, and selects the cell with the shortest distance. It repeats this process until the destination cell is reached or all cells have been visited. The algorithm maintains a list of unvisited cells with their distances initialized to infinity, except for the starting cell which is set to 0. The shortest path can be reconstructed by following previous cells from the destination cell back to the starting cell. Passage weights are small integers, so the next cell is taken from a circular array of buckets indexed by distance (Dial's algorithm); an indexed binary heap can be used instead."
+#define COMPLEXITY "O(V+E+D)"
+
+// Largest passage weight of weighted mazes
+#define MAX_WEIGHT 255
 
 DijkstraAlgorithm::DijkstraAlgorithm() : SolvingAlgorithm("DijkstraAlgorithm") {
     this->description = DESCRIPTION;
     this->complexity = COMPLEXITY;
 }
 
+/**
+ * Sets the priority queue used to pick the next cell
+ * @param bucketQueue true for Dial's bucket queue, false for an indexed binary heap
+ */
+void DijkstraAlgorithm::setBucketQueue(bool bucketQueue) {
+    this->bucketQueue = bucketQueue;
+}
+
+/**
+ * Returns the priority queue used to pick the next cell
+ * @return true for Dial's bucket queue, false for an indexed binary heap
+ */
+bool DijkstraAlgorithm::getBucketQueue() const {
+    return this->bucketQueue;
+}
+
+/**
+ * Sets whether the search runs on the junction graph of the maze, where every corridor is a single edge
+ * @param contraction true to search the cached junction graph, false to search the cells
+ */
+void DijkstraAlgorithm::setContraction(bool contraction) {
+    this->contraction = contraction;
+}
+
+/**
+ * Returns whether the search runs on the junction graph of the maze
+ * @return true to search the cached junction graph, false to search the cells
+ */
+bool DijkstraAlgorithm::getContraction() const {
+    return this->contraction;
+}
+
 Expected<MazePath> DijkstraAlgorithm::solve(Maze &maze) {
     if (maze.isValid().hasError()) return Expected<MazePath>(maze.isValid().errors());
+    if (this->contraction) return this->solveContracted(maze);
 
-    std::map<std::shared_ptr<Node>, std::pair<int, std::shared_ptr<Node>>> nodes;
-    vector<shared_ptr<Node>> path;
+    vector<Node> path;
 
-    Graph graph = maze.getGraph()->clone();
+    shared_ptr<Graph> graph = maze.getGraph();
+    shared_ptr<Adjacency> adjacency = maze.getAdjacency();
     auto startTime = std::chrono::high_resolution_clock::now();
 
-    // Set the IDs of the path
-    for (const auto &node: graph.getNodes()) {
-        node->setID(0);
+    const vector<uint32_t> &offsets = adjacency->getOffsets();
+    const vector<uint32_t> &targets = adjacency->getTargets();
+    const vector<uint8_t> &weights = adjacency->getWeights();
+    bool weighted = adjacency->isWeighted();
+
+    // Reset the IDs of the path, marks are 0 for unseen, 1 for queued and 2 for settled cells
+    this->scratch.reset(graph->size());
+
+    if (this->bucketQueue) {
+        this->buckets.reset(weighted ? MAX_WEIGHT : 1);
+    } else {
+        this->heap.reset(graph->size());
     }
 
     // Get start and end node
-    shared_ptr<Node> startNode = graph.getNode(maze.getStart());
-    shared_ptr<Node> endNode = graph.getNode(maze.getEnd());
+    int start = graph->getIndex(graph->getNode(maze.getStart()));
+    int end = graph->getIndex(graph->getNode(maze.getEnd()));
+
+    // Distances are kept modulo 2^32 and compared by their wrapped difference, queued distances are
+    // never further apart than one passage weight
+    this->scratch.setDistance(start, 0);
+    this->scratch.setMark(start, 1);
 
-    // Initialize all distances to infinity, except for the start node which is 0
-    for (const auto &node: graph.getNodes()) {
-        nodes[node] = std::make_pair(std::numeric_limits<int>::max(), nullptr);
+    if (this->bucketQueue) {
+        this->buckets.push(start, 0);
+    } else {
+        this->heap.push(start, 0);
     }
-    nodes[startNode] = std::make_pair(0, nullptr);
 
-    // Set start as visited
-    std::shared_ptr<Node> currentNode = startNode;
-    startNode->setID(0);
+    int current = -1;
 
-    while (currentNode != endNode) {
-        // Find the node with the smallest distance
-        int distance = std::numeric_limits<int>::max();
+    while (this->bucketQueue ? !this->buckets.empty() : !this->heap.empty()) {
+        uint32_t distance;
+        uint32_t cell = this->bucketQueue ? this->buckets.pop(distance) : this->heap.pop(distance);
 
-        for (const auto &node: nodes) {
-            if (node.first->getID() == 0 && node.second.first < distance) {
-                distance = node.second.first;
-                currentNode = node.first;
-            }
+        // Bucket entries of cells that were settled or reached again at a lower distance are stale
+        if (this->scratch.getMark(cell) == 2 || distance != static_cast<uint32_t>(this->scratch.getDistance(cell))) {
+            continue;
         }
 
-        // Mark the current node as visited
-        currentNode->setID(1);
+        this->scratch.setMark(cell, 2);
+
+        if (static_cast<int>(cell) == end) {
+            current = end;
+            break;
+        }
 
         // Update the distances and parent nodes of the current node's neighbours
-        for (const auto &neighbour: currentNode->getNeighbours()) {
-            int new_distance = nodes[currentNode].first + 1;
+        for (uint32_t i = offsets[cell]; i < offsets[cell + 1]; i++) {
+            uint32_t neighbour = targets[i];
+            int mark = this->scratch.getMark(neighbour);
+
+            if (mark == 2) {
+                continue;
+            }
+
+            uint32_t candidate = distance + (weighted ? weights[i] : 1);
+            uint32_t known = static_cast<uint32_t>(this->scratch.getDistance(neighbour));
 
-            if (new_distance < nodes[neighbour].first) {
-                nodes[neighbour] = std::make_pair(new_distance, currentNode);
+            if (mark == 1 && static_cast<int32_t>(candidate - known) >= 0) {
+                continue;
+            }
+
+            this->scratch.setDistance(neighbour, static_cast<int>(candidate));
+            this->scratch.setParent(neighbour, static_cast<int>(cell));
+            this->scratch.setMark(neighbour, 1);
+
+            if (this->bucketQueue) {
+                this->buckets.push(neighbour, candidate);
+            } else {
+                this->heap.push(neighbour, candidate);
             }
         }
     }
 
+    if (current == -1) {
+        return Expected<MazePath>("No path found");
+    }
+
     // Reconstruct the path
-    while (currentNode != nullptr) {
-        path.push_back(currentNode);
-        currentNode = nodes[currentNode].second;
+    while (current != -1) {
+        path.push_back(graph->getNode(current));
+        current = this->scratch.getParent(current);
     }
 
     // Reverse the path
@@ -74,5 +146,205 @@ Expected<MazePath> DijkstraAlgorithm::solve(Maze &maze) {
     auto endTime = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
 
-    return Expected(MazePath(duration, this->getName(), path));
+    return Expected(MazePath(duration, this->getName(), graph, path));
+}
+
+/**
+ * Endpoint of a search on the junction graph, a junction or a corridor cell reached from both corridor ends
+ */
+struct JunctionEndpoint {
+    int count;
+    uint32_t junctions[2];
+    uint32_t costs[2];
+    uint32_t position;
+};
+
+/**
+ * Solve the maze on its junction graph with an indexed binary heap, then expand the corridors into cells
+ * @param maze maze to solve
+ * @return path from start to end
+ */
+Expected<MazePath> DijkstraAlgorithm::solveContracted(Maze &maze) {
+    vector<Node> path;
+
+    shared_ptr<Graph> graph = maze.getGraph();
+    shared_ptr<JunctionGraph> junctions = maze.getJunctionGraph();
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    const vector<uint32_t> &offsets = junctions->getOffsets();
+    const vector<uint32_t> &targets = junctions->getTargets();
+    const vector<uint32_t> &costs = junctions->getCosts();
+    const vector<uint32_t> &locations = junctions->getLocations();
+    const vector<uint32_t> &junctionCells = junctions->getCells();
+    const vector<uint32_t> &corridorStarts = junctions->getCorridorStarts();
+    const vector<uint32_t> &corridorCells = junctions->getCorridorCells();
+    const vector<uint32_t> &corridorCosts = junctions->getCorridorCosts();
+    const vector<uint32_t> &corridorEnds = junctions->getCorridorEnds();
+
+    // Reset the IDs of the path, parents are junctions and the buffer holds the edge which reached them
+    this->scratch.reset(junctions->size());
+    this->heap.reset(junctions->size());
+
+    vector<int> &edges = this->scratch.getBuffer();
+    if (static_cast<int>(edges.size()) < junctions->size()) edges.resize(junctions->size());
+
+    // Get start and end node
+    uint32_t start = graph->getIndex(graph->getNode(maze.getStart()));
+    uint32_t end = graph->getIndex(graph->getNode(maze.getEnd()));
+
+    // Junctions next to the cell, with the cost between them and the cell
+    auto getEndpoint = [&](uint32_t cell) {
+        JunctionEndpoint endpoint{};
+
+        if (!(locations[cell] & JunctionGraph::CORRIDOR)) {
+            endpoint.count = 1;
+            endpoint.junctions[0] = locations[cell];
+            return endpoint;
+        }
+
+        uint32_t corridor = locations[cell] & ~JunctionGraph::CORRIDOR;
+        uint32_t position = corridorStarts[corridor];
+
+        while (corridorCells[position] != cell) {
+            position++;
+        }
+
+        endpoint.count = 2;
+        endpoint.position = position;
+        endpoint.junctions[0] = corridorEnds[corridor * 2];
+        endpoint.junctions[1] = corridorEnds[corridor * 2 + 1];
+        endpoint.costs[0] = corridorCosts[position];
+        endpoint.costs[1] = corridorCosts[corridorStarts[corridor + 1] - 1] - corridorCosts[position];
+
+        return endpoint;
+    };
+
+    JunctionEndpoint source = getEndpoint(start);
+    JunctionEndpoint target = getEndpoint(end);
+
+    // Seed the junctions next to the start, the buffer remembers through which corridor end (-1 or -2)
+    for (int i = 0; i < source.count; i++) {
+        uint32_t junction = source.junctions[i];
+
+        if (this->scratch.getMark(junction) == 0 || source.costs[i] < static_cast<uint32_t>(this->scratch.getDistance(junction))) {
+            this->scratch.setDistance(junction, static_cast<int>(source.costs[i]));
+            this->scratch.setMark(junction, 1);
+            edges[junction] = -1 - i;
+            this->heap.push(junction, source.costs[i]);
+        }
+    }
+
+    // Start and end in the same corridor can also be joined directly
+    long long best = std::numeric_limits<long long>::max();
+    int bestJunction = -1;
+    int bestSide = 0;
+
+    if (source.count == 2 && target.count == 2 && (locations[start] == locations[end])) {
+        best = std::abs(static_cast<long long>(corridorCosts[source.position]) - corridorCosts[target.position]);
+    }
+
+    while (!this->heap.empty()) {
+        uint32_t distance;
+        uint32_t junction = this->heap.pop(distance);
+
+        if (distance >= best) {
+            break;
+        }
+
+        this->scratch.setMark(junction, 2);
+
+        for (int i = 0; i < target.count; i++) {
+            if (target.junctions[i] == junction && distance + static_cast<long long>(target.costs[i]) < best) {
+                best = distance + static_cast<long long>(target.costs[i]);
+                bestJunction = static_cast<int>(junction);
+                bestSide = i;
+            }
+        }
+
+        // Update the distances and parent junctions of the neighbouring junctions
+        for (uint32_t edge = offsets[junction]; edge < offsets[junction + 1]; edge++) {
+            uint32_t neighbour = targets[edge];
+            int mark = this->scratch.getMark(neighbour);
+            uint32_t candidate = distance + costs[edge];
+
+            if (mark == 2 || (mark == 1 && candidate >= static_cast<uint32_t>(this->scratch.getDistance(neighbour)))) {
+                continue;
+            }
+
+            this->scratch.setDistance(neighbour, static_cast<int>(candidate));
+            this->scratch.setParent(neighbour, static_cast<int>(junction));
+            this->scratch.setMark(neighbour, 1);
+            edges[neighbour] = static_cast<int>(edge);
+            this->heap.push(neighbour, candidate);
+        }
+    }
+
+    if (best == std::numeric_limits<long long>::max()) {
+        return Expected<MazePath>("No path found");
+    }
+
+    vector<uint32_t> cells;
+
+    if (bestJunction == -1) {
+
+        // Straight along the shared corridor
+        if (source.position <= target.position) {
+            for (uint32_t i = source.position; i <= target.position; i++) cells.push_back(corridorCells[i]);
+        } else {
+            for (uint32_t i = source.position + 1; i > target.position; i--) cells.push_back(corridorCells[i - 1]);
+        }
+    } else {
+
+        // Edges from the seeded junction to the last one
+        vector<int> route;
+        int junction = bestJunction;
+
+        while (edges[junction] >= 0) {
+            route.push_back(edges[junction]);
+            junction = this->scratch.getParent(junction);
+        }
+
+        // Start and the corridor cells up to the seeded junction
+        if (source.count == 1) {
+            cells.push_back(start);
+        } else if (edges[junction] == -1) {
+            uint32_t first = corridorStarts[locations[start] & ~JunctionGraph::CORRIDOR];
+
+            for (uint32_t i = source.position + 1; i > first; i--) cells.push_back(corridorCells[i - 1]);
+            cells.push_back(junctionCells[junction]);
+        } else {
+            uint32_t last = corridorStarts[(locations[start] & ~JunctionGraph::CORRIDOR) + 1] - 1;
+
+            for (uint32_t i = source.position; i <= last; i++) cells.push_back(corridorCells[i]);
+        }
+
+        for (auto edge = route.rbegin(); edge != route.rend(); edge++) {
+            junctions->expandEdge(*edge, cells);
+            cells.push_back(junctionCells[targets[*edge]]);
+        }
+
+        // Corridor cells from the last junction up to the end
+        if (target.count == 2) {
+            uint32_t corridor = locations[end] & ~JunctionGraph::CORRIDOR;
+
+            if (bestSide == 0) {
+                for (uint32_t i = corridorStarts[corridor]; i <= target.position; i++) cells.push_back(corridorCells[i]);
+            } else {
+                uint32_t last = corridorStarts[corridor + 1] - 1;
+
+                for (uint32_t i = last; i > target.position; i--) cells.push_back(corridorCells[i - 1]);
+            }
+        }
+    }
+
+    path.reserve(cells.size());
+
+    for (uint32_t cell: cells) {
+        path.push_back(graph->getNode(static_cast<int>(cell)));
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    return Expected(MazePath(duration, this->getName(), graph, path));
 }
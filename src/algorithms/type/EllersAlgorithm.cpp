@@ -0,0 +1,361 @@
+#include "../Algorithm.h"
+
+#include <fstream>
+#include <charconv>
+
+using namespace std;
+
+#define DESCRIPTION "Eller's Algorithm builds a perfect maze one row at a time. Every cell of the current row belongs to a set of cells connected through the rows above. Adjacent cells of different sets are randomly joined, then every set opens at least one passage down into the next row. The last row joins all remaining sets. Only the set labels of a single row are kept in memory, so the maze can be streamed to a file without building the whole graph."
+#define COMPLEXITY "O(V)"
+
+/**
+ * @brief Construct a new Ellers Algorithm:: Ellers Algorithm object
+ */
+EllersAlgorithm::EllersAlgorithm() : GeneratingAlgorithm("Eller", 0) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * @brief Construct a new Ellers Algorithm:: Ellers Algorithm object
+ * @param seed seed of the algorithm
+ */
+EllersAlgorithm::EllersAlgorithm(unsigned int seed) : GeneratingAlgorithm("Eller", seed) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * Generate a maze using the Eller's algorithm
+ * @param width width of the maze
+ * @param height height of the maze
+ * @return MazeBuilder object
+ */
+Expected<MazeBuilder> EllersAlgorithm::generate(int width, int height) {
+    if (this->seed <= 0) return Expected<MazeBuilder>("Seed must be greater than 0");
+    if (width < 2 || height < 2) return Expected<MazeBuilder>("Width and height must be greater than 1");
+
+    // Seed the random number generator
+    this->random.setSeed(this->seed);
+
+    std::shared_ptr<Graph> graph = std::make_shared<Graph>(width, height);
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    Grid &grid = graph->getGrid();
+    this->startRows(width);
+
+    for (int y = 0; y < height; y++) {
+        this->nextRow(y == height - 1);
+
+        for (int x = 0; x < width; x++) {
+            if (this->east[x]) grid.setOpenEast(x, y, true);
+            if (this->south[x]) grid.setOpenSouth(x, y, true);
+        }
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    return Expected<MazeBuilder>(MazeBuilder(width, height, duration, this->getName(), seed, graph));
+}
+
+/**
+ * Append a number to the output buffer
+ * @param out output buffer
+ * @param value number to append
+ */
+static void appendNumber(std::string &out, long long value) {
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+    out.append(buffer, result.ptr);
+}
+
+/**
+ * Append a neighbour object to the output buffer
+ * @param out output buffer
+ * @param x x coordinate of the neighbour
+ * @param y y coordinate of the neighbour
+ * @param first true if the neighbour is the first of its node
+ */
+static void appendNeighbour(std::string &out, int x, int y, bool first) {
+    out += first ? "{\"x\":" : ",{\"x\":";
+    appendNumber(out, x);
+    out += ",\"y\":";
+    appendNumber(out, y);
+    out += '}';
+}
+
+/**
+ * Generate a maze using the Eller's algorithm and write it straight to a text file, row by row.
+ * The file has the format of TextFileSavingMethod, the full graph is never held in memory.
+ * @param width width of the maze
+ * @param height height of the maze
+ * @param start start coordinate of the maze
+ * @param end end coordinate of the maze
+ * @param pathWidth width of the path between walls
+ * @param wallWidth width of the wall between paths
+ * @param fileName path to the output file
+ * @return 0 on success
+ */
+Expected<int> EllersAlgorithm::generateToFile(int width, int height, Coordinate start, Coordinate end, int pathWidth,
+                                              int wallWidth, std::string fileName) {
+    if (this->seed <= 0) return Expected<int>("Seed must be greater than 0");
+    if (width < 2 || height < 2) return Expected<int>("Width and height must be greater than 1");
+
+    // Same checks as Maze::isValid, the maze is never built here
+    std::vector<std::string> errors;
+
+    if (pathWidth <= 0) {
+        errors.emplace_back("Path width must be greater than 0");
+    }
+
+    if (wallWidth <= 0) {
+        errors.emplace_back("Wall width must be greater than 0");
+    }
+
+    if (std::get<0>(start) < 0 || std::get<0>(start) >= width) {
+        errors.emplace_back("Start X coordinate must be between 0 and width");
+    }
+
+    if (std::get<1>(start) < 0 || std::get<1>(start) >= height) {
+        errors.emplace_back("Start Y coordinate must be between 0 and height");
+    }
+
+    if (std::get<0>(end) < 0 || std::get<0>(end) >= width) {
+        errors.emplace_back("End X coordinate must be between 0 and width");
+    }
+
+    if (std::get<1>(end) < 0 || std::get<1>(end) >= height) {
+        errors.emplace_back("End Y coordinate must be between 0 and height");
+    }
+
+    if (start == end) {
+        errors.emplace_back("Start and end coordinates must be different");
+    }
+
+    if (!errors.empty()) {
+        return Expected<int>(errors);
+    }
+
+    // Check if file has a valid extension
+    if (fileName.substr(fileName.length() - 4) != ".txt" && fileName.substr(fileName.length() - 5) != ".json") {
+        return Expected<int>("File name must end with .txt or .json");
+    }
+
+    std::ofstream file(fileName, std::ios::binary);
+
+    if (!file.is_open()) {
+        return Expected<int>("Unable to open file " + fileName);
+    }
+
+    // Seed the random number generator
+    this->random.setSeed(this->seed);
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    std::string out;
+    out += "{\"width\":";
+    appendNumber(out, width);
+    out += ",\"height\":";
+    appendNumber(out, height);
+    out += ",\"generationAlgorithm\":\"" + this->getName() + "\",\"coords\":{\"start\":[";
+    appendNumber(out, std::get<0>(start));
+    out += ',';
+    appendNumber(out, std::get<1>(start));
+    out += "],\"end\":[";
+    appendNumber(out, std::get<0>(end));
+    out += ',';
+    appendNumber(out, std::get<1>(end));
+    out += "]},\"pathWidth\":";
+    appendNumber(out, pathWidth);
+    out += ",\"wallWidth\":";
+    appendNumber(out, wallWidth);
+    out += ",\"seed\":";
+    appendNumber(out, this->seed);
+    out += ",\"mazeNodes\":[";
+
+    // South passages of the previous row are the north passages of the current one
+    std::vector<uint8_t> north(width, 0);
+    this->startRows(width);
+
+    for (int y = 0; y < height; y++) {
+        this->nextRow(y == height - 1);
+
+        for (int x = 0; x < width; x++) {
+            out += (x == 0 && y == 0) ? "{\"x\":" : ",{\"x\":";
+            appendNumber(out, x);
+            out += ",\"y\":";
+            appendNumber(out, y);
+            out += ",\"neighbors\":[";
+
+            // Same order as Graph::getNeighbourRange, east, south, west and north
+            int count = 0;
+
+            if (this->east[x]) {
+                appendNeighbour(out, x + 1, y, count++ == 0);
+            }
+
+            if (this->south[x]) {
+                appendNeighbour(out, x, y + 1, count++ == 0);
+            }
+
+            if (x > 0 && this->east[x - 1]) {
+                appendNeighbour(out, x - 1, y, count++ == 0);
+            }
+
+            if (north[x]) {
+                appendNeighbour(out, x, y - 1, count == 0);
+            }
+
+            out += "]}";
+        }
+
+        file.write(out.data(), static_cast<std::streamsize>(out.size()));
+        out.clear();
+
+        std::copy(this->south.begin(), this->south.end(), north.begin());
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    out += "],\"pathNodes\":[],\"generationTime\":";
+    appendNumber(out, duration);
+    out += '}';
+
+    file.write(out.data(), static_cast<std::streamsize>(out.size()));
+    file.close();
+
+    if (file.fail()) {
+        return Expected<int>("Unable to write file " + fileName);
+    }
+
+    return Expected<int>(0);
+}
+
+/**
+ * Prepare the row state for a maze of given width, every cell of the first row starts in its own set
+ * @param width width of the maze
+ */
+void EllersAlgorithm::startRows(int width) {
+    this->labels.resize(width);
+    this->nextLabels.resize(width);
+    this->parents.resize(width);
+    this->counts.assign(width, 0);
+    this->chosen.assign(width, 0);
+    this->remap.assign(width, -1);
+    this->down.assign(width, 0);
+    this->east.assign(width, 0);
+    this->south.assign(width, 0);
+
+    for (int x = 0; x < width; x++) {
+        this->labels[x] = x;
+    }
+}
+
+/**
+ * Find the representative of a set label in the current row, with path halving
+ * @param label set label
+ * @return representative label
+ */
+int EllersAlgorithm::findLabel(int label) {
+    while (this->parents[label] != label) {
+        this->parents[label] = this->parents[this->parents[label]];
+        label = this->parents[label];
+    }
+
+    return label;
+}
+
+/**
+ * Carve the passages of the current row into east and south, and compute the set labels of the next row.
+ * Labels always stay in range [0, width), so the state never grows beyond one row.
+ * @param last true if the current row is the last one, all sets are then joined
+ */
+void EllersAlgorithm::nextRow(bool last) {
+    int width = static_cast<int>(this->labels.size());
+
+    for (int label = 0; label < width; label++) {
+        this->parents[label] = label;
+    }
+
+    // Randomly join adjacent cells of different sets, the last row joins all of them
+    for (int x = 0; x < width - 1; x++) {
+        int a = this->findLabel(this->labels[x]);
+        int b = this->findLabel(this->labels[x + 1]);
+
+        this->east[x] = a != b && (last || this->random.nextBool());
+
+        if (this->east[x]) {
+            this->parents[b] = a;
+        }
+    }
+
+    this->east[width - 1] = 0;
+
+    for (int x = 0; x < width; x++) {
+        this->labels[x] = this->findLabel(this->labels[x]);
+    }
+
+    if (last) {
+        std::fill(this->south.begin(), this->south.end(), 0);
+        return;
+    }
+
+    // Randomly open passages down, and pick one cell of every set uniformly as a fallback
+    for (int x = 0; x < width; x++) {
+        int label = this->labels[x];
+
+        if (this->random.nextBounded(++this->counts[label]) == 0) {
+            this->chosen[label] = x;
+        }
+
+        this->south[x] = this->random.nextBool();
+        this->down[label] |= this->south[x];
+    }
+
+    // Every set must continue into the next row
+    for (int x = 0; x < width; x++) {
+        int label = this->labels[x];
+
+        if (!this->down[label] && this->chosen[label] == x) {
+            this->south[x] = 1;
+        }
+    }
+
+    // Cells below a passage keep their set, others start a new one, labels are compacted into [0, width)
+    int next = 0;
+
+    for (int x = 0; x < width; x++) {
+        int label = this->labels[x];
+
+        if (this->south[x]) {
+            if (this->remap[label] < 0) {
+                this->remap[label] = next++;
+            }
+
+            this->nextLabels[x] = this->remap[label];
+        } else {
+            this->nextLabels[x] = next++;
+        }
+    }
+
+    for (int x = 0; x < width; x++) {
+        int label = this->labels[x];
+
+        this->counts[label] = 0;
+        this->down[label] = 0;
+        this->remap[label] = -1;
+    }
+
+    this->labels.swap(this->nextLabels);
+}
@@ -0,0 +1,172 @@
+#include "../Algorithm.h"
+
+using namespace std;
+
+#define DESCRIPTION "Hunt-and-Kill Algorithm performs a random walk into unvisited cells, carving passages, until the walk gets stuck. It then hunts for the first unvisited cell next to the maze, connects it to a random visited neighbour and starts a new walk from it. The mazes have long winding river-like passages. Rows with unvisited cells are tracked by summary bits and the hunt finds its cell with bit scans instead of rescanning the grid."
+#define COMPLEXITY "O(V)"
+
+/**
+ * @brief Construct a new Hunt And Kill Algorithm:: Hunt And Kill Algorithm object
+ */
+HuntAndKillAlgorithm::HuntAndKillAlgorithm() : GeneratingAlgorithm("HuntAndKill", 0) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * @brief Construct a new Hunt And Kill Algorithm:: Hunt And Kill Algorithm object
+ * @param seed seed of the algorithm
+ */
+HuntAndKillAlgorithm::HuntAndKillAlgorithm(unsigned int seed) : GeneratingAlgorithm("HuntAndKill", seed) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * Generate a maze using the hunt-and-kill algorithm
+ * @param width width of the maze
+ * @param height height of the maze
+ * @return MazeBuilder object
+ */
+Expected<MazeBuilder> HuntAndKillAlgorithm::generate(int width, int height) {
+    if (this->seed <= 0) return Expected<MazeBuilder>("Seed must be greater than 0");
+    if (width < 2 || height < 2) return Expected<MazeBuilder>("Width and height must be greater than 1");
+
+    // Seed the random number generator
+    this->random.setSeed(this->seed);
+
+    std::shared_ptr<Graph> graph = std::make_shared<Graph>(width, height);
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    Grid &grid = graph->getGrid();
+    int rowWords = grid.getRowWords();
+
+    // Visited bits with the row layout of the grid, the number of unvisited cells of every row,
+    // and one summary bit per row which is set while the row has any unvisited cell
+    std::vector<uint64_t> visited(static_cast<size_t>(rowWords) * height, 0);
+    std::vector<int> unvisited(height, width);
+    std::vector<uint64_t> summary((height + 63) / 64, 0);
+
+    for (int y = 0; y < height; y++) {
+        summary[y / 64] |= uint64_t(1) << (y % 64);
+    }
+
+    auto isVisited = [&](int x, int y) {
+        return (visited[static_cast<size_t>(y) * rowWords + x / 64] >> (x % 64)) & 1;
+    };
+
+    auto visit = [&](int x, int y) {
+        visited[static_cast<size_t>(y) * rowWords + x / 64] |= uint64_t(1) << (x % 64);
+
+        if (--unvisited[y] == 0) {
+            summary[y / 64] &= ~(uint64_t(1) << (y % 64));
+        }
+    };
+
+    // Open the wall between a cell and its neighbour in the direction (0 = E, 1 = S, 2 = W, 3 = N)
+    auto open = [&](int x, int y, int direction) {
+        switch (direction) {
+            case 0: grid.setOpenEast(x, y, true); break;
+            case 1: grid.setOpenSouth(x, y, true); break;
+            case 2: grid.setOpenEast(x - 1, y, true); break;
+            default: grid.setOpenSouth(x, y - 1, true); break;
+        }
+    };
+
+    const int dx[4] = {1, 0, -1, 0};
+    const int dy[4] = {0, 1, 0, -1};
+
+    // Starting in the corner guarantees that the first unvisited cell in row-major order always borders
+    // the maze, from the north or, in the first row, from the west
+    int x = 0;
+    int y = 0;
+    visit(x, y);
+
+    int summaryWord = 0;
+    int huntRow = -1;
+    int huntWord = 0;
+
+    while (true) {
+
+        // Kill: walk into random unvisited neighbours until stuck
+        while (true) {
+            int directions[4];
+            int count = 0;
+
+            for (int direction = 0; direction < 4; direction++) {
+                int nx = x + dx[direction];
+                int ny = y + dy[direction];
+
+                if (nx >= 0 && nx < width && ny >= 0 && ny < height && !isVisited(nx, ny)) {
+                    directions[count++] = direction;
+                }
+            }
+
+            if (count == 0) {
+                break;
+            }
+
+            int direction = directions[count == 1 ? 0 : this->random.nextBounded(count)];
+            open(x, y, direction);
+
+            x += dx[direction];
+            y += dy[direction];
+            visit(x, y);
+        }
+
+        // Hunt: first row with unvisited cells from the summary bits
+        while (summaryWord < static_cast<int>(summary.size()) && summary[summaryWord] == 0) {
+            summaryWord++;
+        }
+
+        if (summaryWord == static_cast<int>(summary.size())) {
+            break;
+        }
+
+        int row = summaryWord * 64 + __builtin_ctzll(summary[summaryWord]);
+
+        if (row != huntRow) {
+            huntRow = row;
+            huntWord = 0;
+        }
+
+        // First unvisited cell of the row, words before the cursor are already fully visited
+        const uint64_t *words = visited.data() + static_cast<size_t>(row) * rowWords;
+
+        while (~words[huntWord] == 0) {
+            huntWord++;
+        }
+
+        x = huntWord * 64 + __builtin_ctzll(~words[huntWord]);
+        y = row;
+
+        // Connect to a random visited neighbour
+        int directions[4];
+        int count = 0;
+
+        for (int direction = 0; direction < 4; direction++) {
+            int nx = x + dx[direction];
+            int ny = y + dy[direction];
+
+            if (nx >= 0 && nx < width && ny >= 0 && ny < height && isVisited(nx, ny)) {
+                directions[count++] = direction;
+            }
+        }
+
+        open(x, y, directions[count == 1 ? 0 : this->random.nextBounded(count)]);
+        visit(x, y);
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    return Expected<MazeBuilder>(MazeBuilder(width, height, duration, this->getName(), seed, graph));
+}
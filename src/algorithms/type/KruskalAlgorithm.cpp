@@ -2,8 +2,8 @@
 
 using namespace std;
 
-#define DESCRIPTION "Kruskal's Algorithm generates a perfect maze with no loops or isolated walls by randomly removing walls to create passages between cells. It creates a list of remaining walls, sorts them by weight, and adds walls with the lowest weights to the maze one by one."
-#define COMPLEXITY "O(E log E)"
+#define DESCRIPTION "Kruskal's Algorithm generates a perfect maze with no loops or isolated walls by randomly removing walls to create passages between cells. It creates a list of all inner walls in random order and removes every wall whose two cells are not yet connected, tracking connected cells in a disjoint-set forest."
+#define COMPLEXITY "O(E a(V))"
 
 /**
  * @brief Construct a new Kruskal Algorithm:: Kruskal Algorithm object
@@ -41,85 +41,72 @@ Expected<MazeBuilder> KruskalAlgorithm::generate(int width, int height) {
     if (width < 2 || height < 2) return Expected<MazeBuilder>("Width and height must be greater than 1");
 
     // Seed the random number generator
-    srand(this->seed);
+    this->random.setSeed(this->seed);
 
     std::shared_ptr<Graph> graph = std::make_shared<Graph>(width, height);
     auto startTime = std::chrono::high_resolution_clock::now();
 
-    // Set the IDs of the nodes
-    for (const auto &node: graph->getNodes()) {
-        node->setID(node->getX() * width + node->getY());
-    }
+    KruskalAlgorithm::carve(graph->getGrid(), 0, 0, width, height, this->random);
+    graph->getGrid().bumpVersion();
 
-    int iters = width * height - 1;
-    while (iters > 0) {
-        // TODO-Extra: Progress Bar
-        // std::cout << iters << "%\r" << std::flush;
-
-        int targetX = rand() % width;
-        int targetY = rand() % height;
-
-        // Randomly choose a direction
-        tuple<int, int> direction = make_tuple(0, 0);
-        switch (rand() % 4) {
-            case 1: {
-                direction = {-1, 0};
-                break;
-            } // LEFT
-            case 2: {
-                direction = {0, -1};
-                break;
-            } // UP
-            case 3: {
-                direction = {1, 0};
-                break;
-            } // RIGHT
-            case 4: {
-                direction = {0, 1};
-                break;
-            } // DOWN
-        }
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
 
-        // Calculate the neighbour coordinates
-        int neighbourX = targetX + get<0>(direction);
-        int neighbourY = targetY + get<1>(direction);
+    return Expected<MazeBuilder>(MazeBuilder(width, height, duration, this->getName(), seed, graph));
+}
 
-        // Check if the neighbour is out of bounds
-        if (neighbourX < 0 || neighbourX >= width || neighbourY < 0 || neighbourY >= height) {
-            continue;
-        }
+/**
+ * Carve a spanning tree into a rectangle of the grid, touching only walls inside the rectangle.
+ * The version of the grid is not bumped, so rectangles which share no word can be carved in parallel.
+ * @param grid grid to carve into
+ * @param left first column of the rectangle
+ * @param top first row of the rectangle
+ * @param right column after the last column of the rectangle
+ * @param bottom row after the last row of the rectangle
+ * @param random random number generator
+ */
+void KruskalAlgorithm::carve(Grid &grid, int left, int top, int right, int bottom, Random &random) {
+    int width = right - left;
+    int height = bottom - top;
+
+    // Collect all inner walls, encoded as cell index * 2 + (0 = east, 1 = south)
+    vector<uint32_t> walls;
+    walls.reserve(static_cast<size_t>(width - 1) * height + static_cast<size_t>(width) * (height - 1));
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            uint32_t cell = x + y * width;
 
-        // Randomly chosen node from the graph
-        shared_ptr<Node> node = graph->getNode(targetX, targetY);
-
-        // Randomly chosen neighbour of the node
-        shared_ptr<Node> neighbour = graph->getNode(neighbourX, neighbourY);
-
-        // Check if the neighbour is already connected to the node
-        if (node->getID() == neighbour->getID()) {
-            continue;
-        } else { // If not, connect them
-            int oldId = neighbour->getID();
-            int newId = node->getID();
-
-            // Update the neighbour id
-            for (int x = 0; x < width; x++) {
-                for (int y = 0; y < height; y++) {
-                    if (graph->getNode(x, y)->getID() == oldId) {
-                        graph->getNode(x, y)->setID(newId);
-                    }
-                }
-            }
-
-            node->addNeighbour(neighbour);
-            neighbour->addNeighbour(node);
+            if (x + 1 < width) walls.push_back(cell * 2);
+            if (y + 1 < height) walls.push_back(cell * 2 + 1);
         }
+    }
 
-        iters--;
+    if (walls.empty()) {
+        return;
     }
 
-    auto endTime = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+    // Fisher-Yates shuffle of the walls
+    for (size_t i = walls.size() - 1; i > 0; i--) {
+        std::swap(walls[i], walls[random.nextBounded(static_cast<uint32_t>(i + 1))]);
+    }
 
-    return Expected<MazeBuilder>(MazeBuilder(width, height, duration, this->getName(), seed, graph));
+    // Remove every wall that joins two separate sets, until a single set is left
+    DisjointSet sets(width * height);
+
+    for (uint32_t wall: walls) {
+        int cell = static_cast<int>(wall / 2);
+        int x = cell % width;
+        int y = cell / width;
+
+        if (wall & 1) {
+            if (sets.unite(cell, cell + width)) grid.carveSouth(left + x, top + y);
+        } else {
+            if (sets.unite(cell, cell + 1)) grid.carveEast(left + x, top + y);
+        }
+
+        if (sets.getSetCount() == 1) {
+            break;
+        }
+    }
 }
@@ -0,0 +1,105 @@
+#include "../Algorithm.h"
+
+using namespace std;
+
+#define DESCRIPTION "Parallel Kruskal's Algorithm splits the maze into fixed size tiles and carves a Kruskal spanning tree into every tile on a pool of worker threads. The tiles are then stitched together by opening one random wall on the boundaries chosen by a disjoint-set forest over the tiles, so the result is still a perfect maze. The tile layout does not depend on the number of threads, so a seed always produces the same maze."
+#define COMPLEXITY "O(E a(V) / T)"
+
+// Tile width is a multiple of 64, so two tiles never share a word of the wall bitmap
+#define TILE_WIDTH 256
+#define TILE_HEIGHT 256
+
+static_assert(TILE_WIDTH % 64 == 0, "Tiles must not share a word of the grid");
+
+/**
+ * @brief Construct a new Parallel Kruskal Algorithm:: Parallel Kruskal Algorithm object
+ */
+ParallelKruskalAlgorithm::ParallelKruskalAlgorithm() : GeneratingAlgorithm("ParallelKruskal", 0) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * @brief Construct a new Parallel Kruskal Algorithm:: Parallel Kruskal Algorithm object
+ * @param seed seed of the algorithm
+ */
+ParallelKruskalAlgorithm::ParallelKruskalAlgorithm(unsigned int seed) : GeneratingAlgorithm("ParallelKruskal", seed) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * Generate a maze using the Kruskal algorithm on tiles carved in parallel
+ * @param width width of the maze
+ * @param height height of the maze
+ * @return MazeBuilder object
+ */
+Expected<MazeBuilder> ParallelKruskalAlgorithm::generate(int width, int height) {
+    if (this->seed <= 0) return Expected<MazeBuilder>("Seed must be greater than 0");
+    if (width < 2 || height < 2) return Expected<MazeBuilder>("Width and height must be greater than 1");
+
+    std::shared_ptr<Graph> graph = std::make_shared<Graph>(width, height);
+    Grid &grid = graph->getGrid();
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    int columns = (width + TILE_WIDTH - 1) / TILE_WIDTH;
+    int rows = (height + TILE_HEIGHT - 1) / TILE_HEIGHT;
+    int tiles = columns * rows;
+
+    // Carve every tile as an independent task
+    this->forEachTask(tiles, [&](int tile) {
+        int left = (tile % columns) * TILE_WIDTH;
+        int top = (tile / columns) * TILE_HEIGHT;
+
+        // Every tile has its own random stream, derived from the seed and the tile index
+        Random random(this->seed, tile);
+
+        KruskalAlgorithm::carve(grid, left, top, min(left + TILE_WIDTH, width), min(top + TILE_HEIGHT, height), random);
+    });
+
+    // Collect all tile boundaries, encoded as tile index * 2 + (0 = east, 1 = south)
+    this->random.setSeed(this->seed);
+    vector<uint32_t> boundaries;
+
+    for (int tile = 0; tile < tiles; tile++) {
+        if (tile % columns + 1 < columns) boundaries.push_back(tile * 2);
+        if (tile / columns + 1 < rows) boundaries.push_back(tile * 2 + 1);
+    }
+
+    for (size_t i = boundaries.size(); i > 1; i--) {
+        std::swap(boundaries[i - 1], boundaries[this->random.nextBounded(static_cast<uint32_t>(i))]);
+    }
+
+    // Stitch the tiles into a single tree by opening one random wall on a boundary between separate tile sets
+    DisjointSet sets(tiles);
+
+    for (uint32_t boundary: boundaries) {
+        int tile = static_cast<int>(boundary / 2);
+        int left = (tile % columns) * TILE_WIDTH;
+        int top = (tile / columns) * TILE_HEIGHT;
+        int right = min(left + TILE_WIDTH, width);
+        int bottom = min(top + TILE_HEIGHT, height);
+
+        if (boundary & 1) {
+            if (sets.unite(tile, tile + columns)) grid.carveSouth(left + this->random.nextBounded(right - left), bottom - 1);
+        } else {
+            if (sets.unite(tile, tile + 1)) grid.carveEast(right - 1, top + this->random.nextBounded(bottom - top));
+        }
+    }
+
+    // The workers carved without bumping the version, the grid changes once for the whole maze
+    grid.bumpVersion();
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    return Expected<MazeBuilder>(MazeBuilder(width, height, duration, this->getName(), seed, graph));
+}
@@ -0,0 +1,117 @@
+#include "../Algorithm.h"
+
+using namespace std;
+
+#define DESCRIPTION "Randomized Prim's Algorithm grows the maze from a random cell. It keeps a frontier of cells adjacent to the maze, repeatedly removes a random frontier cell, connects it to a random neighbour already in the maze and adds its outside neighbours to the frontier. The mazes have many short dead ends. The frontier is a dense array with a position table, so picking and removing a random cell takes constant time."
+#define COMPLEXITY "O(V)"
+
+#define OUTSIDE 0xFFFFFFFFu
+#define IN_MAZE 0xFFFFFFFEu
+
+/**
+ * @brief Construct a new Prims Algorithm:: Prims Algorithm object
+ */
+PrimsAlgorithm::PrimsAlgorithm() : GeneratingAlgorithm("Prim", 0) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * @brief Construct a new Prims Algorithm:: Prims Algorithm object
+ * @param seed seed of the algorithm
+ */
+PrimsAlgorithm::PrimsAlgorithm(unsigned int seed) : GeneratingAlgorithm("Prim", seed) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * Generate a maze using the randomized Prim's algorithm
+ * @param width width of the maze
+ * @param height height of the maze
+ * @return MazeBuilder object
+ */
+Expected<MazeBuilder> PrimsAlgorithm::generate(int width, int height) {
+    if (this->seed <= 0) return Expected<MazeBuilder>("Seed must be greater than 0");
+    if (width < 2 || height < 2) return Expected<MazeBuilder>("Width and height must be greater than 1");
+
+    // Seed the random number generator
+    this->random.setSeed(this->seed);
+
+    std::shared_ptr<Graph> graph = std::make_shared<Graph>(width, height);
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    Grid &grid = graph->getGrid();
+    uint32_t cells = static_cast<uint32_t>(graph->size());
+
+    // Position of every cell in the frontier array, or OUTSIDE / IN_MAZE
+    std::vector<uint32_t> positions(cells, OUTSIDE);
+    std::vector<uint32_t> frontier;
+    frontier.reserve(cells);
+
+    auto add = [&](uint32_t cell) {
+        if (positions[cell] == OUTSIDE) {
+            positions[cell] = static_cast<uint32_t>(frontier.size());
+            frontier.push_back(cell);
+        }
+    };
+
+    auto grow = [&](uint32_t cell) {
+        int x = static_cast<int>(cell % width);
+        int y = static_cast<int>(cell / width);
+
+        positions[cell] = IN_MAZE;
+
+        if (x + 1 < width) add(cell + 1);
+        if (y + 1 < height) add(cell + width);
+        if (x > 0) add(cell - 1);
+        if (y > 0) add(cell - width);
+    };
+
+    grow(this->random.nextBounded(cells));
+
+    while (!frontier.empty()) {
+
+        // Swap-remove a random frontier cell
+        uint32_t index = this->random.nextBounded(static_cast<uint32_t>(frontier.size()));
+        uint32_t cell = frontier[index];
+
+        frontier[index] = frontier.back();
+        positions[frontier[index]] = index;
+        frontier.pop_back();
+
+        // Connect it to a random neighbour inside the maze (0 = E, 1 = S, 2 = W, 3 = N)
+        int x = static_cast<int>(cell % width);
+        int y = static_cast<int>(cell / width);
+
+        int directions[4];
+        int count = 0;
+
+        if (x + 1 < width && positions[cell + 1] == IN_MAZE) directions[count++] = 0;
+        if (y + 1 < height && positions[cell + width] == IN_MAZE) directions[count++] = 1;
+        if (x > 0 && positions[cell - 1] == IN_MAZE) directions[count++] = 2;
+        if (y > 0 && positions[cell - width] == IN_MAZE) directions[count++] = 3;
+
+        switch (directions[count == 1 ? 0 : this->random.nextBounded(count)]) {
+            case 0: grid.setOpenEast(x, y, true); break;
+            case 1: grid.setOpenSouth(x, y, true); break;
+            case 2: grid.setOpenEast(x - 1, y, true); break;
+            default: grid.setOpenSouth(x, y - 1, true); break;
+        }
+
+        grow(cell);
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    return Expected<MazeBuilder>(MazeBuilder(width, height, duration, this->getName(), seed, graph));
+}
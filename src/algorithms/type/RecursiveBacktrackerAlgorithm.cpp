@@ -0,0 +1,117 @@
+#include "../Algorithm.h"
+
+using namespace std;
+
+#define DESCRIPTION "Recursive Backtracker is a randomized depth-first search. It walks from the current cell into a random unvisited neighbour, carving a passage, and backtracks when the current cell has no unvisited neighbours left. It produces mazes with long winding corridors and few dead ends. The search keeps an explicit stack of cell indices and a bitset of visited cells, so it never recurses."
+#define COMPLEXITY "O(V)"
+
+/**
+ * @brief Construct a new Recursive Backtracker Algorithm:: Recursive Backtracker Algorithm object
+ */
+RecursiveBacktrackerAlgorithm::RecursiveBacktrackerAlgorithm() : GeneratingAlgorithm("RecursiveBacktracker", 0) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * @brief Construct a new Recursive Backtracker Algorithm:: Recursive Backtracker Algorithm object
+ * @param seed seed of the algorithm
+ */
+RecursiveBacktrackerAlgorithm::RecursiveBacktrackerAlgorithm(unsigned int seed)
+        : GeneratingAlgorithm("RecursiveBacktracker", seed) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * Generate a maze using the randomized depth-first search
+ * @param width width of the maze
+ * @param height height of the maze
+ * @return MazeBuilder object
+ */
+Expected<MazeBuilder> RecursiveBacktrackerAlgorithm::generate(int width, int height) {
+    if (this->seed <= 0) return Expected<MazeBuilder>("Seed must be greater than 0");
+    if (width < 2 || height < 2) return Expected<MazeBuilder>("Width and height must be greater than 1");
+
+    // Seed the random number generator
+    this->random.setSeed(this->seed);
+
+    std::shared_ptr<Graph> graph = std::make_shared<Graph>(width, height);
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    Grid &grid = graph->getGrid();
+    uint32_t cells = static_cast<uint32_t>(graph->size());
+
+    // One bit per cell, set once the cell joins the maze
+    std::vector<uint64_t> visited((cells + 63) / 64, 0);
+    std::vector<uint32_t> stack;
+
+    auto isVisited = [&visited](uint32_t cell) { return (visited[cell / 64] >> (cell % 64)) & 1; };
+
+    uint32_t start = this->random.nextBounded(cells);
+    visited[start / 64] |= uint64_t(1) << (start % 64);
+    stack.push_back(start);
+
+    while (!stack.empty()) {
+        uint32_t current = stack.back();
+        int x = static_cast<int>(current % width);
+        int y = static_cast<int>(current / width);
+
+        // Gather unvisited neighbours, stored as cell index and direction (0 = E, 1 = S, 2 = W, 3 = N)
+        uint32_t candidates[4];
+        int directions[4];
+        int count = 0;
+
+        if (x + 1 < width && !isVisited(current + 1)) {
+            candidates[count] = current + 1;
+            directions[count++] = 0;
+        }
+
+        if (y + 1 < height && !isVisited(current + width)) {
+            candidates[count] = current + width;
+            directions[count++] = 1;
+        }
+
+        if (x > 0 && !isVisited(current - 1)) {
+            candidates[count] = current - 1;
+            directions[count++] = 2;
+        }
+
+        if (y > 0 && !isVisited(current - width)) {
+            candidates[count] = current - width;
+            directions[count++] = 3;
+        }
+
+        // Dead end, backtrack
+        if (count == 0) {
+            stack.pop_back();
+            continue;
+        }
+
+        int choice = count == 1 ? 0 : static_cast<int>(this->random.nextBounded(count));
+        uint32_t next = candidates[choice];
+
+        switch (directions[choice]) {
+            case 0: grid.setOpenEast(x, y, true); break;
+            case 1: grid.setOpenSouth(x, y, true); break;
+            case 2: grid.setOpenEast(x - 1, y, true); break;
+            default: grid.setOpenSouth(x, y - 1, true); break;
+        }
+
+        visited[next / 64] |= uint64_t(1) << (next % 64);
+        stack.push_back(next);
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    return Expected<MazeBuilder>(MazeBuilder(width, height, duration, this->getName(), seed, graph));
+}
@@ -0,0 +1,228 @@
+#include "../Algorithm.h"
+
+using namespace std;
+
+#define DESCRIPTION "Recursive Division Algorithm starts from a grid without inner walls and divides it into two chambers by a wall with a single random passage. Both chambers are divided again until they are one cell wide or high. The mazes have long straight walls. After the first levels of division the chambers are carved as independent tasks on a pool of worker threads. Walls are placed at uniformly random positions on every level, and words of the wall bitmap shared by two neighbouring chambers are changed with atomic operations."
+#define COMPLEXITY "O(V log V)"
+
+// Chambers larger than this are divided before the tasks are handed to the workers
+#define TASK_CELLS 65536
+
+/**
+ * @brief Rectangle of cells [left, right) x [top, bottom) divided by the algorithm.
+ */
+struct Chamber {
+    int left;
+    int top;
+    int right;
+    int bottom;
+};
+
+/**
+ * Check if a word of a row may be shared with a neighbouring chamber, carved at the same time by another worker
+ * @param chamber chamber owning the cells
+ * @param word index of the word in the row
+ * @return true if the chamber does not cover all cells of the word
+ */
+static bool isShared(const Chamber &chamber, int word) {
+    return word * 64 < chamber.left || (word + 1) * 64 > chamber.right;
+}
+
+/**
+ * Clear bits of a word of the grid, shared words are changed atomically
+ * @param word word of the grid
+ * @param mask bits to clear
+ * @param shared true if another worker may change the word at the same time
+ */
+static void clearBits(uint64_t &word, uint64_t mask, bool shared) {
+    if (shared) {
+        __atomic_fetch_and(&word, ~mask, __ATOMIC_RELAXED);
+    } else {
+        word &= ~mask;
+    }
+}
+
+/**
+ * Set bits of a word of the grid, shared words are changed atomically
+ * @param word word of the grid
+ * @param mask bits to set
+ * @param shared true if another worker may change the word at the same time
+ */
+static void setBits(uint64_t &word, uint64_t mask, bool shared) {
+    if (shared) {
+        __atomic_fetch_or(&word, mask, __ATOMIC_RELAXED);
+    } else {
+        word |= mask;
+    }
+}
+
+/**
+ * Close a horizontal wall below the row of the chamber, keeping one passage
+ * @param grid grid to carve into
+ * @param chamber chamber to divide
+ * @param y row above the wall
+ * @param passage column of the passage
+ */
+static void closeHorizontal(Grid &grid, const Chamber &chamber, int y, int passage) {
+    uint64_t *south = grid.rawSouthRow(y);
+
+    for (int x = chamber.left; x < chamber.right;) {
+        int word = x / 64;
+        int end = min(chamber.right, (word + 1) * 64);
+
+        uint64_t mask = (end - x == 64 ? ~uint64_t(0) : ((uint64_t(1) << (end - x)) - 1)) << (x % 64);
+        clearBits(south[word], mask, isShared(chamber, word));
+
+        x = end;
+    }
+
+    setBits(south[passage / 64], uint64_t(1) << (passage % 64), isShared(chamber, passage / 64));
+}
+
+/**
+ * Close a vertical wall right of the column of the chamber, keeping one passage
+ * @param grid grid to carve into
+ * @param chamber chamber to divide
+ * @param x column left of the wall
+ * @param passage row of the passage
+ */
+static void closeVertical(Grid &grid, const Chamber &chamber, int x, int passage) {
+    uint64_t mask = uint64_t(1) << (x % 64);
+    bool shared = isShared(chamber, x / 64);
+
+    for (int y = chamber.top; y < chamber.bottom; y++) {
+        if (y != passage) {
+            clearBits(grid.rawEastRow(y)[x / 64], mask, shared);
+        }
+    }
+}
+
+/**
+ * Divide the chamber by a wall with a single passage, across its longer side and squares in a random direction
+ * @param grid grid to carve into
+ * @param chamber chamber to divide
+ * @param random random number generator
+ * @param chambers list the two new chambers are added to
+ */
+static void divide(Grid &grid, const Chamber &chamber, Random &random, std::vector<Chamber> &chambers) {
+    int chamberWidth = chamber.right - chamber.left;
+    int chamberHeight = chamber.bottom - chamber.top;
+
+    if (chamberWidth < 2 || chamberHeight < 2) {
+        return;
+    }
+
+    bool horizontal = chamberHeight > chamberWidth || (chamberHeight == chamberWidth && random.nextBool());
+
+    if (horizontal) {
+        int y = chamber.top + static_cast<int>(random.nextBounded(chamberHeight - 1));
+        closeHorizontal(grid, chamber, y, chamber.left + static_cast<int>(random.nextBounded(chamberWidth)));
+
+        chambers.push_back({chamber.left, chamber.top, chamber.right, y + 1});
+        chambers.push_back({chamber.left, y + 1, chamber.right, chamber.bottom});
+    } else {
+        int x = chamber.left + static_cast<int>(random.nextBounded(chamberWidth - 1));
+        closeVertical(grid, chamber, x, chamber.top + static_cast<int>(random.nextBounded(chamberHeight)));
+
+        chambers.push_back({chamber.left, chamber.top, x + 1, chamber.bottom});
+        chambers.push_back({x + 1, chamber.top, chamber.right, chamber.bottom});
+    }
+}
+
+/**
+ * @brief Construct a new Recursive Division Algorithm:: Recursive Division Algorithm object
+ */
+RecursiveDivisionAlgorithm::RecursiveDivisionAlgorithm() : GeneratingAlgorithm("RecursiveDivision", 0) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * @brief Construct a new Recursive Division Algorithm:: Recursive Division Algorithm object
+ * @param seed seed of the algorithm
+ */
+RecursiveDivisionAlgorithm::RecursiveDivisionAlgorithm(unsigned int seed)
+        : GeneratingAlgorithm("RecursiveDivision", seed) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * Generate a maze using the recursive division algorithm
+ * @param width width of the maze
+ * @param height height of the maze
+ * @return MazeBuilder object
+ */
+Expected<MazeBuilder> RecursiveDivisionAlgorithm::generate(int width, int height) {
+    if (this->seed <= 0) return Expected<MazeBuilder>("Seed must be greater than 0");
+    if (width < 2 || height < 2) return Expected<MazeBuilder>("Width and height must be greater than 1");
+
+    // Seed the random number generator
+    this->random.setSeed(this->seed);
+
+    std::shared_ptr<Graph> graph = std::make_shared<Graph>(width, height);
+    Grid &grid = graph->getGrid();
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    int rowWords = grid.getRowWords();
+
+    // Open all inner walls
+    uint64_t lastCells = width % 64 == 0 ? ~uint64_t(0) : (uint64_t(1) << (width % 64)) - 1;
+    uint64_t lastColumn = uint64_t(1) << ((width - 1) % 64);
+
+    // Workers write through the raw accessors, the grid changes once for the whole maze
+    grid.bumpVersion();
+
+    this->forEachRow(height, [&](int y) {
+        uint64_t *east = grid.rawEastRow(y);
+        uint64_t *south = grid.rawSouthRow(y);
+
+        for (int word = 0; word < rowWords; word++) {
+            uint64_t cells = word == rowWords - 1 ? lastCells : ~uint64_t(0);
+
+            east[word] = word == rowWords - 1 ? cells & ~lastColumn : cells;
+            south[word] = y == height - 1 ? 0 : cells;
+        }
+    });
+
+    // Divide the top levels sequentially, the chambers left are divided as independent tasks
+    std::vector<Chamber> pending = {{0, 0, width, height}};
+    std::vector<Chamber> tasks;
+
+    while (!pending.empty()) {
+        Chamber chamber = pending.back();
+        pending.pop_back();
+
+        if (static_cast<long long>(chamber.right - chamber.left) * (chamber.bottom - chamber.top) <= TASK_CELLS) {
+            tasks.push_back(chamber);
+        } else {
+            divide(grid, chamber, this->random, pending);
+        }
+    }
+
+    // Divide every chamber as an independent task, each with its own random stream
+    this->forEachTask(static_cast<int>(tasks.size()), [&](int index) {
+        Random random(this->seed, index);
+        std::vector<Chamber> stack = {tasks[index]};
+
+        while (!stack.empty()) {
+            Chamber chamber = stack.back();
+            stack.pop_back();
+
+            divide(grid, chamber, random, stack);
+        }
+    });
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    return Expected<MazeBuilder>(MazeBuilder(width, height, duration, this->getName(), seed, graph));
+}
@@ -0,0 +1,97 @@
+#include "../Algorithm.h"
+
+using namespace std;
+
+#define DESCRIPTION "Sidewinder Algorithm carves every row into horizontal runs of random length. Each run opens the south wall of one random cell, and the last row is a single corridor. Rows are independent, so the run boundaries are drawn 64 cells at a time from a single random word, the runs are walked with bit scans and rows are split between threads. The mazes have a long corridor along the south edge and a vertical bias."
+#define COMPLEXITY "O(V)"
+
+/**
+ * @brief Construct a new Sidewinder Algorithm:: Sidewinder Algorithm object
+ */
+SidewinderAlgorithm::SidewinderAlgorithm() : GeneratingAlgorithm("Sidewinder", 0) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * @brief Construct a new Sidewinder Algorithm:: Sidewinder Algorithm object
+ * @param seed seed of the algorithm
+ */
+SidewinderAlgorithm::SidewinderAlgorithm(unsigned int seed) : GeneratingAlgorithm("Sidewinder", seed) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * Generate a maze using the Sidewinder algorithm, one word of 64 cells at a time
+ * @param width width of the maze
+ * @param height height of the maze
+ * @return MazeBuilder object
+ */
+Expected<MazeBuilder> SidewinderAlgorithm::generate(int width, int height) {
+    if (this->seed <= 0) return Expected<MazeBuilder>("Seed must be greater than 0");
+    if (width < 2 || height < 2) return Expected<MazeBuilder>("Width and height must be greater than 1");
+
+    std::shared_ptr<Graph> graph = std::make_shared<Graph>(width, height);
+    Grid &grid = graph->getGrid();
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    int rowWords = grid.getRowWords();
+
+    // Cells of the last word, and the east wall of the last column which has to stay closed
+    uint64_t lastCells = width % 64 == 0 ? ~uint64_t(0) : (uint64_t(1) << (width % 64)) - 1;
+    uint64_t lastColumn = uint64_t(1) << ((width - 1) % 64);
+
+    // Workers write whole rows through the raw accessors, the grid changes once for the whole maze
+    grid.bumpVersion();
+
+    this->forEachRow(height, [&](int y) {
+        uint64_t *east = grid.rawEastRow(y);
+        uint64_t *south = grid.rawSouthRow(y);
+
+        // Every row has its own random stream, so the maze does not depend on the number of threads
+        Random random(this->seed, y);
+
+        // An open east wall continues the run, a closed one ends it, the last column always ends it
+        for (int word = 0; word < rowWords; word++) {
+            uint64_t eastCells = word == rowWords - 1 ? lastCells & ~lastColumn : ~uint64_t(0);
+
+            east[word] = y == height - 1 ? eastCells : random.next() & eastCells;
+        }
+
+        if (y == height - 1) {
+            return;
+        }
+
+        // Walk the runs by scanning for closed east walls, and open south from a random cell of every run
+        int start = 0;
+
+        while (start < width) {
+            int word = start / 64;
+            uint64_t ends = ~east[word] & (~uint64_t(0) << (start % 64));
+
+            while (ends == 0) {
+                ends = ~east[++word];
+            }
+
+            int end = word * 64 + __builtin_ctzll(ends);
+            int cell = start + static_cast<int>(random.nextBounded(end - start + 1));
+
+            south[cell / 64] |= uint64_t(1) << (cell % 64);
+            start = end + 1;
+        }
+    });
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    return Expected<MazeBuilder>(MazeBuilder(width, height, duration, this->getName(), seed, graph));
+}
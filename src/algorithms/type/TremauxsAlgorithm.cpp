@@ -13,47 +13,59 @@ TremauxsAlgorithm::TremauxsAlgorithm() : SolvingAlgorithm("TremauxsAlgorithm") {
 Expected<MazePath> TremauxsAlgorithm::solve(Maze &maze) {
     if (maze.isValid().hasError()) return Expected<MazePath>(maze.isValid().errors());
 
-    vector<std::shared_ptr<Node>> path;
-
-    Graph graph = maze.getGraph()->clone();
+    shared_ptr<Graph> graph = maze.getGraph();
+    shared_ptr<Adjacency> adjacency = maze.getAdjacency();
     auto startTime = std::chrono::high_resolution_clock::now();
 
-    // Set the IDs of the nodes
-    for (const auto &node: graph.getNodes()) {
-        node->setID(0);
-    }
+    const vector<uint32_t> &offsets = adjacency->getOffsets();
+    const vector<uint32_t> &targets = adjacency->getTargets();
+
+    // Restart the random choices from the seed
+    this->random.setSeed(this->seed);
+
+    // Reset the IDs of the nodes
+    this->scratch.reset(graph->size());
+
+    vector<int> &path = this->scratch.getBuffer();
+    path.clear();
 
     // Initialize the startNode and endNode nodes
-    shared_ptr<Node> startNode = graph.getNode(maze.getStart());
-    shared_ptr<Node> endNode = graph.getNode(maze.getEnd());
+    int start = graph->getIndex(graph->getNode(maze.getStart()));
+    int end = graph->getIndex(graph->getNode(maze.getEnd()));
 
     // Set startNode as visited
-    shared_ptr<Node> currentNode = startNode;
-    path.push_back(startNode);
-    currentNode->setID(1);
+    int current = start;
+    path.push_back(start);
+    this->scratch.setMark(current, 1);
 
     // Iterate through the maze until we reach the endNode
-    while (currentNode != endNode) {
-        vector<std::shared_ptr<Node>> neighbours;
+    while (current != end) {
+        int neighbours[4];
+        int count = 0;
 
-        for (auto &neighbour: currentNode->getNeighbours()) {
-            if (neighbour->getID() == 0) {
-                neighbours.push_back(neighbour);
+        for (uint32_t i = offsets[current]; i < offsets[current + 1]; i++) {
+            if (this->scratch.getMark(targets[i]) == 0) {
+                neighbours[count++] = static_cast<int>(targets[i]);
             }
         }
 
-        if (!neighbours.empty()) {
-            auto next = neighbours[rand() % neighbours.size()];
+        if (count > 0) {
+            int next = neighbours[this->random.nextBounded(count)];
 
             // Mark the chosen neighbour and move to it
-            next->setID(1);
+            this->scratch.setMark(next, 1);
             path.push_back(next);
 
-            currentNode = next;
+            current = next;
         } else { // If all neighbours have been visited, backtrack to the last unvisited node
             path.pop_back();
-            currentNode->setID(2);
-            currentNode = path.back();
+            this->scratch.setMark(current, 2);
+
+            if (path.empty()) {
+                break;
+            }
+
+            current = path.back();
         }
     }
 
@@ -61,8 +73,15 @@ Expected<MazePath> TremauxsAlgorithm::solve(Maze &maze) {
         return Expected<MazePath>("No path found");
     }
 
+    vector<Node> nodes;
+    nodes.reserve(path.size());
+
+    for (int index: path) {
+        nodes.push_back(graph->getNode(index));
+    }
+
     auto endTime = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
 
-    return Expected(MazePath(duration, this->getName(), path));
+    return Expected(MazePath(duration, this->getName(), graph, nodes));
 }
\ No newline at end of file
@@ -13,58 +13,64 @@ WallFollowingAlgorithm::WallFollowingAlgorithm() : SolvingAlgorithm("WallFollowi
 Expected<MazePath> WallFollowingAlgorithm::solve(Maze &maze) {
     if (maze.isValid().hasError()) return Expected<MazePath>(maze.isValid().errors());
 
-    stack<shared_ptr<Node>> stack;
-    vector<shared_ptr<Node>> path;
+    vector<Node> path;
 
-    Graph graph = maze.getGraph()->clone();
+    shared_ptr<Graph> graph = maze.getGraph();
+    shared_ptr<Adjacency> adjacency = maze.getAdjacency();
     auto startTime = std::chrono::high_resolution_clock::now();
 
-    // Set the IDs of the path
-    for (const auto &node: graph.getNodes()) {
-        node->setID(0);
-    }
+    const vector<uint32_t> &offsets = adjacency->getOffsets();
+    const vector<uint32_t> &targets = adjacency->getTargets();
+
+    // Reset the IDs of the path
+    this->scratch.reset(graph->size());
+
+    vector<int> &stack = this->scratch.getBuffer();
+    stack.clear();
 
     // Get start and end node
-    shared_ptr<Node> startNode = graph.getNode(maze.getStart());
-    shared_ptr<Node> endNode = graph.getNode(maze.getEnd());
+    int start = graph->getIndex(graph->getNode(maze.getStart()));
+    int end = graph->getIndex(graph->getNode(maze.getEnd()));
+    int width = graph->getWidth();
 
     // Set start as visited
-    shared_ptr<Node> currentNode = startNode;
-    stack.push(startNode);
-    startNode->setID(1);
+    stack.push_back(start);
+    this->scratch.setMark(start, 1);
 
     // Iterate through the stack until path is found
     while (!stack.empty()) {
-        shared_ptr<Node> currentNode = stack.top();
+        int current = stack.back();
 
         // If end is found, reconstruct path
-        if (currentNode == endNode) {
+        if (current == end) {
             break;
         }
 
         bool found = false;
-        for (const auto &neighbor: currentNode->getNeighbours()) {
-            if (neighbor->getID() == 0) {
-                if (neighbor->getX() == currentNode->getX() + 1) {
-                    currentNode = neighbor;
+        for (uint32_t i = offsets[current]; i < offsets[current + 1]; i++) {
+            int neighbour = static_cast<int>(targets[i]);
+
+            if (this->scratch.getMark(neighbour) == 0) {
+                if (neighbour == current + 1) {
+                    current = neighbour;
                     found = true;
                     break;
                 }
 
-                if (neighbor->getY() == currentNode->getY() - 1) {
-                    currentNode = neighbor;
+                if (neighbour == current - width) {
+                    current = neighbour;
                     found = true;
                     break;
                 }
 
-                if (neighbor->getX() == currentNode->getX() - 1) {
-                    currentNode = neighbor;
+                if (neighbour == current - 1) {
+                    current = neighbour;
                     found = true;
                     break;
                 }
 
-                if (neighbor->getY() == currentNode->getY() + 1) {
-                    currentNode = neighbor;
+                if (neighbour == current + width) {
+                    current = neighbour;
                     found = true;
                     break;
                 }
@@ -72,10 +78,10 @@ Expected<MazePath> WallFollowingAlgorithm::solve(Maze &maze) {
         }
 
         if (found) {
-            currentNode->setID(1);
-            stack.push(currentNode);
+            this->scratch.setMark(current, 1);
+            stack.push_back(current);
         } else {
-            stack.pop();
+            stack.pop_back();
         }
     }
 
@@ -83,15 +89,15 @@ Expected<MazePath> WallFollowingAlgorithm::solve(Maze &maze) {
         return Expected<MazePath>("No path found");
     }
 
-    while (!stack.empty()) {
-        path.push_back(stack.top());
-        stack.pop();
-    }
+    // The stack holds the path from start to end
+    path.reserve(stack.size());
 
-    reverse(path.begin(), path.end());
+    for (int index: stack) {
+        path.push_back(graph->getNode(index));
+    }
 
     auto endTime = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
 
-    return Expected(MazePath(duration, this->getName(), path));
-}
\ No newline at end of file
+    return Expected(MazePath(duration, this->getName(), graph, path));
+}
@@ -0,0 +1,131 @@
+#include "../Algorithm.h"
+
+using namespace std;
+
+#define DESCRIPTION "Wilson's Algorithm generates a maze drawn uniformly from all spanning trees of the grid. It starts with one random cell in the maze, then repeatedly performs a random walk from a cell outside the maze until the walk hits the maze, and adds the loop-erased path of the walk. Loops are erased implicitly, every cell only remembers the direction in which the walk last left it."
+#define COMPLEXITY "O(V log V) expected"
+
+#define IN_MAZE 4
+
+/**
+ * @brief Construct a new Wilsons Algorithm:: Wilsons Algorithm object
+ */
+WilsonsAlgorithm::WilsonsAlgorithm() : GeneratingAlgorithm("Wilson", 0) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * @brief Construct a new Wilsons Algorithm:: Wilsons Algorithm object
+ * @param seed seed of the algorithm
+ */
+WilsonsAlgorithm::WilsonsAlgorithm(unsigned int seed) : GeneratingAlgorithm("Wilson", seed) {
+    if (seed == 0) {
+        this->seed = time(nullptr);
+    }
+
+    this->description = DESCRIPTION;
+    this->complexity = COMPLEXITY;
+}
+
+/**
+ * Generate a maze using the Wilson's algorithm
+ * @param width width of the maze
+ * @param height height of the maze
+ * @return MazeBuilder object
+ */
+Expected<MazeBuilder> WilsonsAlgorithm::generate(int width, int height) {
+    if (this->seed <= 0) return Expected<MazeBuilder>("Seed must be greater than 0");
+    if (width < 2 || height < 2) return Expected<MazeBuilder>("Width and height must be greater than 1");
+
+    // Seed the random number generator
+    this->random.setSeed(this->seed);
+
+    std::shared_ptr<Graph> graph = std::make_shared<Graph>(width, height);
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    Grid &grid = graph->getGrid();
+    uint32_t cells = static_cast<uint32_t>(graph->size());
+
+    // Direction in which the walk last left every cell (0 = E, 1 = S, 2 = W, 3 = N), or IN_MAZE
+    std::vector<uint8_t> directions(cells, 0);
+    const int64_t offsets[4] = {1, width, -1, -width};
+
+    directions[this->random.nextBounded(cells)] = IN_MAZE;
+    this->walkSteps = 0;
+
+    // Random directions are taken two bits at a time from a 64-bit word
+    uint64_t bits = 0;
+    int remaining = 0;
+
+    for (uint32_t start = 0; start < cells; start++) {
+        if (directions[start] == IN_MAZE) {
+            continue;
+        }
+
+        // Random walk until the maze is hit, overwriting directions erases the loops
+        uint32_t current = start;
+        int x = static_cast<int>(start % width);
+        int y = static_cast<int>(start / width);
+
+        while (directions[current] != IN_MAZE) {
+            int direction;
+
+            do {
+                if (remaining == 0) {
+                    bits = this->random.next();
+                    remaining = 32;
+                }
+
+                direction = static_cast<int>(bits & 3);
+                bits >>= 2;
+                remaining--;
+            } while ((direction == 0 && x == width - 1) || (direction == 1 && y == height - 1) ||
+                     (direction == 2 && x == 0) || (direction == 3 && y == 0));
+
+            directions[current] = static_cast<uint8_t>(direction);
+            current = static_cast<uint32_t>(current + offsets[direction]);
+
+            x += direction == 0 ? 1 : direction == 2 ? -1 : 0;
+            y += direction == 1 ? 1 : direction == 3 ? -1 : 0;
+
+            this->walkSteps++;
+        }
+
+        // Add the loop-erased path to the maze
+        current = start;
+        x = static_cast<int>(start % width);
+        y = static_cast<int>(start / width);
+
+        while (directions[current] != IN_MAZE) {
+            int direction = directions[current];
+            directions[current] = IN_MAZE;
+
+            switch (direction) {
+                case 0: grid.setOpenEast(x++, y, true); break;
+                case 1: grid.setOpenSouth(x, y++, true); break;
+                case 2: grid.setOpenEast(--x, y, true); break;
+                default: grid.setOpenSouth(x, --y, true); break;
+            }
+
+            current = static_cast<uint32_t>(current + offsets[direction]);
+        }
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    return Expected<MazeBuilder>(MazeBuilder(width, height, duration, this->getName(), seed, graph));
+}
+
+/**
+ * Get number of random walk steps taken by the last generated maze
+ * @return number of walk steps
+ */
+long long WilsonsAlgorithm::getWalkSteps() const {
+    return this->walkSteps;
+}
@@ -0,0 +1,757 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <algorithm>
+#include <optional>
+#include <variant>
+#include <chrono>
+#include <functional>
+#include <filesystem>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "../headers/Expected.h"
+
+#include "../maze/Maze.h"
+#include "../algorithms/Algorithm.h"
+#include "../method/Method.h"
+#include "../interface/Interface.h"
+
+using namespace std;
+
+/**
+ * @brief Timing summary of one benchmarked operation.
+ */
+struct Result {
+    std::string category;
+    std::string generator;
+    std::string name;
+    int width;
+    int height;
+    int repetitions;
+    int failures;
+    long long min;
+    long long median;
+    long long p95;
+    long long p99;
+    double cellsPerSecond;
+    long long peakMemory;
+};
+
+/**
+ * @brief Solver configured for one benchmarked mode, labelled with the name of the mode.
+ */
+struct BenchSolver {
+    std::string name;
+    std::shared_ptr<SolvingAlgorithm> solver;
+};
+
+/**
+ * @brief Get peak resident set size of the process
+ * @return peak resident set size in kilobytes
+ */
+long long getPeakMemory() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<long long>(counters.PeakWorkingSetSize / 1024);
+    }
+
+    return 0;
+#else
+    struct rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+/**
+ * @brief Split comma separated list into lowercase parts
+ * @param value comma separated list
+ * @return list of parts
+ */
+std::vector<std::string> split(std::string value) {
+    std::vector<std::string> parts;
+    std::stringstream stream(value);
+    std::string part;
+
+    while (std::getline(stream, part, ',')) {
+        if (!part.empty()) {
+            std::transform(part.begin(), part.end(), part.begin(), ::tolower);
+            parts.push_back(part);
+        }
+    }
+
+    return parts;
+}
+
+/**
+ * @brief Check if algorithm name is selected by user filter
+ * @param filter selected names, or "all"
+ * @param name name of algorithm
+ * @return true if algorithm is selected
+ */
+bool isSelected(const std::vector<std::string> &filter, std::string name) {
+    std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+
+    for (const auto &part: filter) {
+        if (part == "all" || name.find(part) != std::string::npos) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Get value at given percentile of sorted samples (nearest-rank method)
+ * @param samples sorted samples
+ * @param percentile percentile in range (0, 1]
+ * @return sample at percentile
+ */
+long long getPercentile(const std::vector<long long> &samples, double percentile) {
+    size_t rank = static_cast<size_t>(std::ceil(percentile * static_cast<double>(samples.size())));
+
+    return samples[std::max<size_t>(rank, 1) - 1];
+}
+
+/**
+ * @brief Check if two grids have the same walls
+ * @param a first grid
+ * @param b second grid
+ * @return true if both grids have the same size and the same open passages
+ */
+bool isSameGrid(const Grid &a, const Grid &b) {
+    if (a.getWidth() != b.getWidth() || a.getHeight() != b.getHeight()) {
+        return false;
+    }
+
+    for (int y = 0; y < a.getHeight(); y++) {
+        if (!std::equal(a.getEastRow(y), a.getEastRow(y) + a.getRowWords(), b.getEastRow(y)) ||
+            !std::equal(a.getSouthRow(y), a.getSouthRow(y) + a.getRowWords(), b.getSouthRow(y))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Parse a maze size given on the command line
+ * @param value text of the size
+ * @return size, or 0 if the text is not a whole number of at least 2
+ */
+int parseSize(const std::string &value) {
+    if (value.empty() || value.size() > 9 || !std::all_of(value.begin(), value.end(), ::isdigit)) {
+        return 0;
+    }
+
+    int size = std::stoi(value);
+
+    return size >= 2 ? size : 0;
+}
+
+/**
+ * @brief Run operation repeatedly and time every run after the warmup
+ * @param warmup number of untimed runs
+ * @param repetitions number of timed runs
+ * @param operation operation to measure, returns false on failure
+ * @param samples filled with the time of every timed run in nanoseconds
+ * @return number of failed timed runs
+ */
+int runTimed(int warmup, int repetitions, const std::function<bool()> &operation, std::vector<long long> &samples) {
+    int failures = 0;
+
+    samples.clear();
+    samples.reserve(repetitions);
+
+    for (int i = 0; i < warmup; i++) {
+        operation();
+    }
+
+    for (int i = 0; i < repetitions; i++) {
+        auto startTime = std::chrono::high_resolution_clock::now();
+        bool success = operation();
+        auto endTime = std::chrono::high_resolution_clock::now();
+
+        if (!success) {
+            failures++;
+        }
+
+        samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count());
+    }
+
+    return failures;
+}
+
+#ifndef _WIN32
+
+/**
+ * @brief Run the timed runs in a forked child, so that its peak resident set size belongs to this operation
+ * alone, and not to the largest operation measured so far. The child starts with the memory of the benchmark,
+ * including the maze being solved, and sends back the failures, samples and its peak through a pipe.
+ * @param warmup number of untimed runs
+ * @param repetitions number of timed runs
+ * @param operation operation to measure, returns false on failure
+ * @param samples filled with the time of every timed run in nanoseconds
+ * @param failures number of failed timed runs
+ * @param peakMemory peak resident set size of the child in kilobytes
+ * @return false if the child could not be run
+ */
+bool runForked(int warmup, int repetitions, const std::function<bool()> &operation, std::vector<long long> &samples,
+               int &failures, long long &peakMemory) {
+    int pipes[2];
+
+    if (pipe(pipes) != 0) {
+        return false;
+    }
+
+    cout.flush();
+    cerr.flush();
+
+    pid_t child = fork();
+
+    if (child < 0) {
+        close(pipes[0]);
+        close(pipes[1]);
+        return false;
+    }
+
+    if (child == 0) {
+        close(pipes[0]);
+
+        std::vector<long long> childSamples;
+        long long header[2];
+        header[0] = runTimed(warmup, repetitions, operation, childSamples);
+        header[1] = getPeakMemory();
+
+        bool written = write(pipes[1], header, sizeof(header)) == sizeof(header)
+                       && write(pipes[1], childSamples.data(), childSamples.size() * sizeof(long long))
+                          == static_cast<ssize_t>(childSamples.size() * sizeof(long long));
+
+        close(pipes[1]);
+        _exit(written ? 0 : 1);
+    }
+
+    close(pipes[1]);
+
+    std::vector<char> data;
+    char chunk[4096];
+    ssize_t count;
+
+    while ((count = read(pipes[0], chunk, sizeof(chunk))) > 0) {
+        data.insert(data.end(), chunk, chunk + count);
+    }
+
+    close(pipes[0]);
+
+    int status = 0;
+    waitpid(child, &status, 0);
+
+    size_t expected = (2 + static_cast<size_t>(repetitions)) * sizeof(long long);
+
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 || data.size() != expected) {
+        return false;
+    }
+
+    long long header[2];
+    std::memcpy(header, data.data(), sizeof(header));
+
+    samples.resize(repetitions);
+    std::memcpy(samples.data(), data.data() + sizeof(header), repetitions * sizeof(long long));
+
+    failures = static_cast<int>(header[0]);
+    peakMemory = header[1];
+
+    return true;
+}
+
+#endif
+
+/**
+ * @brief Run operation repeatedly and collect timing statistics. Where processes can be forked the runs happen
+ * in a child process and the peak resident set size is the one of that child, otherwise it is the peak of
+ * the whole benchmark so far.
+ * @param warmup number of untimed runs
+ * @param repetitions number of timed runs
+ * @param operation operation to measure, returns false on failure
+ * @param result result to fill with statistics
+ */
+void measure(int warmup, int repetitions, const std::function<bool()> &operation, Result &result) {
+    std::vector<long long> samples;
+
+#ifdef _WIN32
+    result.failures = runTimed(warmup, repetitions, operation, samples);
+    result.peakMemory = getPeakMemory();
+#else
+    if (!runForked(warmup, repetitions, operation, samples, result.failures, result.peakMemory)) {
+        cerr << " mazelib_bench:  - Child process failed, measuring in the benchmark process" << endl;
+
+        result.failures = runTimed(warmup, repetitions, operation, samples);
+        result.peakMemory = getPeakMemory();
+    }
+#endif
+
+    std::sort(samples.begin(), samples.end());
+
+    result.repetitions = repetitions;
+    result.min = samples.front();
+    result.median = getPercentile(samples, 0.50);
+    result.p95 = getPercentile(samples, 0.95);
+    result.p99 = getPercentile(samples, 0.99);
+    result.cellsPerSecond = result.median > 0
+                            ? static_cast<double>(result.width) * result.height * 1e9 / static_cast<double>(result.median)
+                            : 0.0;
+}
+
+/**
+ * @brief Write results as CSV
+ * @param out output stream
+ * @param results benchmark results
+ */
+void writeCsv(std::ostream &out, const std::vector<Result> &results) {
+    out << "category,generator,name,width,height,cells,repetitions,failures,min_ns,median_ns,p95_ns,p99_ns,"
+           "cells_per_second,peak_rss_kb" << endl;
+
+    for (const auto &result: results) {
+        out << result.category << ","
+            << result.generator << ","
+            << result.name << ","
+            << result.width << ","
+            << result.height << ","
+            << (static_cast<long long>(result.width) * result.height) << ","
+            << result.repetitions << ","
+            << result.failures << ","
+            << result.min << ","
+            << result.median << ","
+            << result.p95 << ","
+            << result.p99 << ","
+            << static_cast<long long>(result.cellsPerSecond) << ","
+            << result.peakMemory << endl;
+    }
+}
+
+/**
+ * @brief Write results as JSON array
+ * @param out output stream
+ * @param results benchmark results
+ */
+void writeJson(std::ostream &out, const std::vector<Result> &results) {
+    out << "[" << endl;
+
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result &result = results[i];
+
+        out << "  {"
+            << "\"category\": \"" << result.category << "\", "
+            << "\"generator\": \"" << result.generator << "\", "
+            << "\"name\": \"" << result.name << "\", "
+            << "\"width\": " << result.width << ", "
+            << "\"height\": " << result.height << ", "
+            << "\"cells\": " << (static_cast<long long>(result.width) * result.height) << ", "
+            << "\"repetitions\": " << result.repetitions << ", "
+            << "\"failures\": " << result.failures << ", "
+            << "\"minNs\": " << result.min << ", "
+            << "\"medianNs\": " << result.median << ", "
+            << "\"p95Ns\": " << result.p95 << ", "
+            << "\"p99Ns\": " << result.p99 << ", "
+            << "\"cellsPerSecond\": " << static_cast<long long>(result.cellsPerSecond) << ", "
+            << "\"peakRssKb\": " << result.peakMemory
+            << "}" << (i + 1 < results.size() ? "," : "") << endl;
+    }
+
+    out << "]" << endl;
+}
+
+int main(int argc, char **argv) {
+
+    Interface interface = Interface();
+    interface.setUsage("mazelib_bench: Unknown command, try 'mazelib_bench run --help' or 'mazelib_bench verify --help' for more information!");
+
+    // Unknown command
+    interface.setDefault([=]() {
+        cout << endl << interface.getUsage() << endl;
+        return 0;
+    });
+
+    Category run = Category("run")
+            .setDescription("Benchmark generators, solvers and saving/loading methods")
+            .setUsage("mazelib_bench run [options]")
+            .addOption(Option("sizes")
+                               .addAliases({"-s", "--sizes"})
+                               .addArguments({"string"})
+                               .setDescription("Square maze sizes to sweep, separated by commas")
+                               .setDefaults({"64,256,1024"})
+            )
+            .addOption(Option("generators")
+                               .addAliases({"-g", "--generators"})
+                               .addArguments({"string"})
+                               .setDescription("Generating algorithms to benchmark, separated by commas")
+                               .setDefaults({"all"})
+            )
+            .addOption(Option("algorithms")
+                               .addAliases({"-a", "--algorithms"})
+                               .addArguments({"string"})
+                               .setDescription("Solving algorithms to benchmark, separated by commas")
+                               .setDefaults({"all"})
+            )
+            .addOption(Option("warmup")
+                               .addAliases({"-w", "--warmup"})
+                               .addArguments({"int"})
+                               .setDescription("Number of untimed runs before measuring")
+                               .setDefaults({2})
+            )
+            .addOption(Option("repetitions")
+                               .addAliases({"-r", "--repetitions"})
+                               .addArguments({"int"})
+                               .setDescription("Number of timed runs of every operation")
+                               .setDefaults({20})
+            )
+            .addOption(Option("seed")
+                               .addAliases({"-se", "--seed"})
+                               .addArguments({"int"})
+                               .setDescription("Seed of generating algorithms")
+                               .setDefaults({1})
+            )
+            .addOption(Option("braid")
+                               .addAliases({"-b", "--braid"})
+                               .addArguments({"double"})
+                               .setDescription("Fraction of dead ends removed before solving, creates loops")
+                               .setDefaults({0.0})
+            )
+            .addOption(Option("weights")
+                               .addAliases({"-we", "--weights"})
+                               .addArguments({"int", "int"})
+                               .setDescription("Largest passage cost and terrain scale, solvers also run on weighted mazes")
+                               .setDefaults({0, 8})
+            )
+            .addOption(Option("threads")
+                               .addAliases({"-t", "--threads"})
+                               .addArguments({"int"})
+                               .setDescription("Worker threads of parallel generators and solvers (0 = all cores)")
+                               .setDefaults({0})
+            )
+            .addOption(Option("methods")
+                               .addAliases({"-m", "--methods"})
+                               .setDescription("Benchmark also saving and loading methods")
+            )
+            .addOption(Option("format")
+                               .addAliases({"-f", "--format"})
+                               .addArguments({"string"})
+                               .setDescription("Output format, csv or json")
+                               .setDefaults({"csv"})
+            )
+            .addOption(Option("output")
+                               .addAliases({"-o", "--output"})
+                               .addArguments({"string"})
+                               .setDescription("Path to the file, where results will be saved")
+            )
+            .returns(
+                    [=](std::map<std::string, std::optional<std::vector<std::variant<int, double, bool, std::string, std::nullopt_t>>>> map) {
+
+                        std::vector<std::string> sizeValues = split(std::get<std::string>(map["sizes"].value()[0]));
+                        std::vector<std::string> generatorFilter = split(std::get<std::string>(map["generators"].value()[0]));
+                        std::vector<std::string> solverFilter = split(std::get<std::string>(map["algorithms"].value()[0]));
+                        int warmup = std::get<int>(map["warmup"].value()[0]);
+                        int repetitions = std::get<int>(map["repetitions"].value()[0]);
+                        int seed = std::get<int>(map["seed"].value()[0]);
+                        int threads = std::get<int>(map["threads"].value()[0]);
+                        double braid = std::get<double>(map["braid"].value()[0]);
+                        int maxWeight = std::get<int>(map["weights"].value()[0]);
+                        int scale = std::get<int>(map["weights"].value()[1]);
+                        bool methods = std::get<bool>(map["methods"].value()[0]);
+                        std::string format = std::get<std::string>(map["format"].value()[0]);
+
+                        if (repetitions < 1 || warmup < 0) {
+                            cerr << " mazelib_bench: Repetitions must be greater than 0 and warmup must not be negative" << endl;
+                            return 1;
+                        }
+
+                        if (format != "csv" && format != "json") {
+                            cerr << " mazelib_bench: Unknown output format: " << format << endl;
+                            return 1;
+                        }
+
+                        std::vector<int> sizes;
+                        for (const auto &sizeValue: sizeValues) {
+                            int size = parseSize(sizeValue);
+
+                            if (size == 0) {
+                                cerr << " mazelib_bench: Invalid maze size: " << sizeValue << ", sizes must be whole numbers of at least 2" << endl;
+                                return 1;
+                            }
+
+                            sizes.push_back(size);
+                        }
+
+                        std::vector<std::shared_ptr<GeneratingAlgorithm>> generators;
+                        for (const auto &alg: Algorithm::getGenerators()) {
+                            if (isSelected(generatorFilter, alg->getName())) {
+                                generators.push_back(alg);
+                            }
+                        }
+
+                        // Every solver in its default mode, followed by the other modes worth comparing
+                        std::vector<BenchSolver> modes;
+                        for (const auto &alg: Algorithm::getSolvers()) {
+                            if (auto deadEndFilling = std::dynamic_pointer_cast<DeadEndFillingAlgorithm>(alg)) {
+                                deadEndFilling->setThreads(threads);
+                            }
+
+                            modes.push_back({alg->getName(), alg});
+                        }
+
+                        auto directionOptimizing = std::make_shared<BreadthFirstSearchAlgorithm>();
+                        directionOptimizing->setDirectionOptimizing(true);
+                        modes.push_back({"BreadthFirstSearch:DirectionOptimizing", directionOptimizing});
+
+                        // The junction graph is cached on the maze, so the warmup runs pay for building it
+                        auto contracted = std::make_shared<DijkstraAlgorithm>();
+                        contracted->setContraction(true);
+                        modes.push_back({"DijkstraAlgorithm:Contracted", contracted});
+
+                        std::vector<BenchSolver> solvers;
+                        for (const auto &mode: modes) {
+                            if (isSelected(solverFilter, mode.name)) {
+                                solvers.push_back(mode);
+                            }
+                        }
+
+                        if (generators.empty()) {
+                            cerr << " mazelib_bench: No generating algorithms was found." << endl;
+                            return 1;
+                        }
+
+                        std::vector<std::shared_ptr<SavingMethod>> savers = {
+                                std::make_shared<TextFileSavingMethod>(),
+                                std::make_shared<ImageSavingMethod>()
+                        };
+
+                        std::filesystem::path directory = std::filesystem::temp_directory_path();
+                        std::string textFile = (directory / "mazelib_bench.txt").string();
+                        std::string imageFile = (directory / "mazelib_bench.png").string();
+
+                        std::vector<Result> results;
+
+                        for (int size: sizes) {
+                            for (const auto &generator: generators) {
+                                generator->setSeed(seed);
+                                generator->setThreads(threads);
+
+                                cerr << " mazelib_bench: " << generator->getName() << " " << size << "x" << size << endl;
+
+                                // Generating
+                                Result generating{"generate", generator->getName(), generator->getName(), size, size};
+                                measure(warmup, repetitions, [&]() {
+                                    return !generator->generate(size, size).hasError();
+                                }, generating);
+                                results.push_back(generating);
+
+                                Expected<MazeBuilder> builder = generator->generate(size, size);
+                                if (builder.hasError()) {
+                                    cerr << " mazelib_bench:  - Generating failed. Error: " << builder.error() << endl;
+                                    continue;
+                                }
+
+                                MazeBuilder mazeBuilder = builder.value();
+
+                                if (braid > 0) {
+                                    mazeBuilder.removeDeadEnds(braid);
+                                }
+
+                                mazeBuilder.setStart({0, 0});
+                                mazeBuilder.setEnd({size - 1, size - 1});
+
+                                Maze maze = mazeBuilder.build();
+
+                                // Solving
+                                for (const auto &solver: solvers) {
+                                    Result solving{"solve", generator->getName(), solver.name, size, size};
+                                    measure(warmup, repetitions, [&]() {
+                                        return !solver.solver->solve(maze).hasError();
+                                    }, solving);
+                                    results.push_back(solving);
+                                }
+
+                                // Solving with passage costs, reported separately
+                                if (maxWeight > 0) {
+                                    mazeBuilder.addWeights(maxWeight, scale);
+                                    Maze weightedMaze = mazeBuilder.build();
+
+                                    for (const auto &solver: solvers) {
+                                        Result solving{"solve_weighted", generator->getName(), solver.name, size, size};
+                                        measure(warmup, repetitions, [&]() {
+                                            return !solver.solver->solve(weightedMaze).hasError();
+                                        }, solving);
+                                        results.push_back(solving);
+                                    }
+                                }
+
+                                if (!methods) {
+                                    continue;
+                                }
+
+                                // Saving
+                                for (const auto &saver: savers) {
+                                    std::string file = saver->getName() == "Image File" ? imageFile : textFile;
+
+                                    Result saving{"save", generator->getName(), saver->getName(), size, size};
+                                    measure(warmup, repetitions, [&]() {
+                                        return !saver->save(maze, file).hasError();
+                                    }, saving);
+                                    results.push_back(saving);
+                                }
+
+                                // Loading, reads the text file written above
+                                TextFileSavingMethod().save(maze, textFile);
+                                TextFileLoadingMethod loader;
+
+                                Result loading{"load", generator->getName(), loader.getName(), size, size};
+                                measure(warmup, repetitions, [&]() {
+                                    return !loader.load(textFile).hasError();
+                                }, loading);
+                                results.push_back(loading);
+                            }
+                        }
+
+                        if (methods) {
+                            std::error_code error;
+                            std::filesystem::remove(textFile, error);
+                            std::filesystem::remove(imageFile, error);
+                        }
+
+                        if (map["output"].has_value()) {
+                            std::string output = std::get<std::string>(map["output"].value()[0]);
+                            std::ofstream file(output);
+
+                            if (!file.is_open()) {
+                                cerr << " mazelib_bench: Unable to open output file: " << output << endl;
+                                return 1;
+                            }
+
+                            format == "json" ? writeJson(file, results) : writeCsv(file, results);
+                        } else {
+                            format == "json" ? writeJson(cout, results) : writeCsv(cout, results);
+                        }
+
+                        return 0;
+                    });
+    interface.addCategory(run);
+
+    // Parallel generators must produce the same maze for a seed on any number of threads. Build with
+    // -DENABLE_TSAN=ON to run the parallel workers under the thread sanitizer as well.
+    Category verify = Category("verify")
+            .setDescription("Check that generators give the same maze on one and on many threads")
+            .setUsage("mazelib_bench verify [options]")
+            .addOption(Option("sizes")
+                               .addAliases({"-s", "--sizes"})
+                               .addArguments({"string"})
+                               .setDescription("Square maze sizes to check, separated by commas")
+                               .setDefaults({"64,600"})
+            )
+            .addOption(Option("generators")
+                               .addAliases({"-g", "--generators"})
+                               .addArguments({"string"})
+                               .setDescription("Generating algorithms to check, separated by commas")
+                               .setDefaults({"all"})
+            )
+            .addOption(Option("seed")
+                               .addAliases({"-se", "--seed"})
+                               .addArguments({"int"})
+                               .setDescription("Seed of generating algorithms")
+                               .setDefaults({1})
+            )
+            .addOption(Option("threads")
+                               .addAliases({"-t", "--threads"})
+                               .addArguments({"int"})
+                               .setDescription("Worker threads compared against a single thread")
+                               .setDefaults({4})
+            )
+            .returns(
+                    [=](std::map<std::string, std::optional<std::vector<std::variant<int, double, bool, std::string, std::nullopt_t>>>> map) {
+
+                        std::vector<std::string> sizeValues = split(std::get<std::string>(map["sizes"].value()[0]));
+                        std::vector<std::string> generatorFilter = split(std::get<std::string>(map["generators"].value()[0]));
+                        int seed = std::get<int>(map["seed"].value()[0]);
+                        int threads = std::get<int>(map["threads"].value()[0]);
+
+                        if (threads < 2) {
+                            cerr << " mazelib_bench: Threads must be at least 2" << endl;
+                            return 1;
+                        }
+
+                        std::vector<int> sizes;
+                        for (const auto &sizeValue: sizeValues) {
+                            int size = parseSize(sizeValue);
+
+                            if (size == 0) {
+                                cerr << " mazelib_bench: Invalid maze size: " << sizeValue << ", sizes must be whole numbers of at least 2" << endl;
+                                return 1;
+                            }
+
+                            sizes.push_back(size);
+                        }
+
+                        int checked = 0;
+                        int failed = 0;
+
+                        for (const auto &generator: Algorithm::getGenerators()) {
+                            if (!isSelected(generatorFilter, generator->getName())) {
+                                continue;
+                            }
+
+                            for (int size: sizes) {
+                                generator->setSeed(seed);
+                                generator->setThreads(1);
+                                Expected<MazeBuilder> single = generator->generate(size, size);
+
+                                generator->setSeed(seed);
+                                generator->setThreads(threads);
+                                Expected<MazeBuilder> parallel = generator->generate(size, size);
+
+                                bool same = !single.hasError() && !parallel.hasError() &&
+                                            isSameGrid(std::as_const(*single.value().getGraph()).getGrid(),
+                                                       std::as_const(*parallel.value().getGraph()).getGrid());
+
+                                cout << " mazelib_bench: " << generator->getName() << " " << size << "x" << size << ": "
+                                     << (same ? "same" : "DIFFERENT") << endl;
+
+                                checked++;
+                                failed += same ? 0 : 1;
+                            }
+                        }
+
+                        if (checked == 0) {
+                            cerr << " mazelib_bench: No generating algorithms was found." << endl;
+                            return 1;
+                        }
+
+                        cout << " mazelib_bench: " << checked - failed << " of " << checked << " mazes are the same on "
+                             << threads << " threads" << endl;
+
+                        return failed == 0 ? 0 : 1;
+                    });
+    interface.addCategory(verify);
+
+    return interface.run(argc, argv);
+}
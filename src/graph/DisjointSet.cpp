@@ -0,0 +1,82 @@
+#include "DisjointSet.h"
+
+/**
+ * @brief Construct a new Disjoint Set:: Disjoint Set object with every element in its own set
+ * @param size Number of elements
+ */
+DisjointSet::DisjointSet(int size) {
+    this->sets = size > 0 ? size : 0;
+    this->parents.resize(this->sets);
+    this->ranks.assign(this->sets, 0);
+
+    for (int i = 0; i < this->sets; i++) {
+        this->parents[i] = i;
+    }
+}
+
+/**
+ * @brief Find the representative of the set containing the element
+ * @param element Element to look up
+ * @return Representative of the set
+ */
+int DisjointSet::find(int element) {
+    uint32_t root = element;
+
+    while (this->parents[root] != root) {
+        root = this->parents[root];
+    }
+
+    // Compress the path so every visited element points directly to the root
+    uint32_t current = element;
+
+    while (this->parents[current] != root) {
+        uint32_t next = this->parents[current];
+        this->parents[current] = root;
+        current = next;
+    }
+
+    return static_cast<int>(root);
+}
+
+/**
+ * @brief Merge the sets containing the two elements
+ * @param a First element
+ * @param b Second element
+ * @return false if both elements already were in the same set
+ */
+bool DisjointSet::unite(int a, int b) {
+    int rootA = this->find(a);
+    int rootB = this->find(b);
+
+    if (rootA == rootB) {
+        return false;
+    }
+
+    if (this->ranks[rootA] < this->ranks[rootB]) {
+        this->parents[rootA] = rootB;
+    } else if (this->ranks[rootA] > this->ranks[rootB]) {
+        this->parents[rootB] = rootA;
+    } else {
+        this->parents[rootB] = rootA;
+        this->ranks[rootA]++;
+    }
+
+    this->sets--;
+    return true;
+}
+
+/**
+ * @brief Get the number of elements
+ * @return Number of elements
+ */
+int DisjointSet::size() const {
+    return static_cast<int>(this->parents.size());
+}
+
+/**
+ * @brief Get the number of disjoint sets left
+ * @return Number of sets
+ */
+int DisjointSet::getSetCount() const {
+    return this->sets;
+}
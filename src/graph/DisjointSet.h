@@ -0,0 +1,27 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Disjoint-set forest over the integers 0 .. size - 1, with path compression and union by rank.
+ */
+class DisjointSet {
+private:
+    std::vector<uint32_t> parents;
+    std::vector<uint8_t> ranks;
+    int sets;
+
+public:
+    explicit DisjointSet(int size);
+
+    ~DisjointSet() = default;
+
+    int find(int element);
+
+    bool unite(int a, int b);
+
+    int size() const;
+
+    int getSetCount() const;
+};
@@ -1,5 +1,13 @@
 #include "Graph.h"
 
+/**
+ * @brief Construct a new Node:: Node object at the origin
+ */
+Node::Node() {
+    this->x = 0;
+    this->y = 0;
+}
+
 /**
  * @brief Construct a new Node:: Node object
  * @param x X coordinate
@@ -8,7 +16,6 @@
 Node::Node(int x, int y) {
     this->x = x;
     this->y = y;
-    this->id = 0;
 }
 
 /**
@@ -28,97 +35,353 @@ int Node::getY() const {
 }
 
 /**
- * @brief Set the ID of the node
- * @param id ID to set
- * @return ID of the node
+ * @brief Compare two nodes by their coordinates
+ * @param other Node to compare with
+ * @return true if both nodes point to the same cell
  */
-void Node::setID(int id) {
-    this->id = id;
+bool Node::operator==(const Node &other) const {
+    return this->x == other.x && this->y == other.y;
 }
 
 /**
- * @brief Get the ID of the node
- * @return ID of the node
+ * @brief Compare two nodes by their coordinates
+ * @param other Node to compare with
+ * @return true if the nodes point to different cells
  */
-int Node::getID() const {
-    return this->id;
+bool Node::operator!=(const Node &other) const {
+    return !(*this == other);
 }
 
 /**
- * @brief Add a neighbour to the node
- * @param node Node to add as neighbour
+ * ====================================================
+ */
+
+/**
+ * @brief Construct a new Grid:: Grid object with all walls closed
+ * @param width Width of the grid
+ * @param height Height of the grid
  */
-void Node::addNeighbour(std::shared_ptr<Node> node) {
-    this->neighbours.push_back(node);
+Grid::Grid(int width, int height) {
+    this->width = width > 0 ? width : 0;
+    this->height = height > 0 ? height : 0;
+    this->rowWords = (this->width + 63) / 64;
+
+    this->bits.assign(static_cast<size_t>(this->rowWords) * 2 * this->height, 0);
 }
 
 /**
- * @brief Get the neighbours of the node
- * @return Vector of neighbours
+ * @brief Get the width of the grid
+ * @return Width of the grid
  */
-std::vector<std::shared_ptr<Node>> Node::getNeighbours() {
-    return this->neighbours;
+int Grid::getWidth() const {
+    return this->width;
 }
 
 /**
- * @brief Clear the neighbours of the node
- * @return
+ * @brief Get the height of the grid
+ * @return Height of the grid
  */
-void Node::clearNeighbours() {
-    this->neighbours.clear();
+int Grid::getHeight() const {
+    return this->height;
 }
 
 /**
- * ====================================================
+ * @brief Get the number of cells in the grid
+ * @return Number of cells
  */
+int Grid::size() const {
+    return this->width * this->height;
+}
 
 /**
- * @brief Construct a new Graph:: Graph object
- * @param width Width of the graph
- * @param height Height of the graph
+ * @brief Check if the cell has a passage to its east neighbour
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @return true if the east wall is open
  */
-Graph::Graph(int width, int height) {
-    this->width = width;
-    this->height = height;
+bool Grid::isOpenEast(int x, int y) const {
+    size_t word = static_cast<size_t>(y) * this->rowWords * 2 + x / 64;
+    return (this->bits[word] >> (x % 64)) & 1;
+}
 
-    // Initialize nodes
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            this->nodes.push_back(std::make_shared<Node>(x, y));
-        }
+/**
+ * @brief Check if the cell has a passage to its south neighbour
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @return true if the south wall is open
+ */
+bool Grid::isOpenSouth(int x, int y) const {
+    size_t word = static_cast<size_t>(y) * this->rowWords * 2 + this->rowWords + x / 64;
+    return (this->bits[word] >> (x % 64)) & 1;
+}
+
+/**
+ * @brief Open or close the east wall of the cell, the east wall of the last column can only be closed
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @param open true to open the wall, false to close it
+ */
+void Grid::setOpenEast(int x, int y, bool open) {
+    if (x < 0 || y < 0 || y >= this->height || x >= (open ? this->width - 1 : this->width)) {
+        throw std::out_of_range("East wall of cell " + std::to_string(x) + ", " + std::to_string(y) + " is out of range");
     }
+
+    this->version++;
+
+    size_t word = static_cast<size_t>(y) * this->rowWords * 2 + x / 64;
+    uint64_t mask = uint64_t(1) << (x % 64);
+
+    this->bits[word] = open ? (this->bits[word] | mask) : (this->bits[word] & ~mask);
 }
 
 /**
- * @brief Destroy the Graph:: Graph object
+ * @brief Open or close the south wall of the cell, the south wall of the last row can only be closed
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @param open true to open the wall, false to close it
  */
-Graph::~Graph() {
-    for (const auto &node: this->nodes) {
-        node->clearNeighbours();
+void Grid::setOpenSouth(int x, int y, bool open) {
+    if (x < 0 || x >= this->width || y < 0 || y >= (open ? this->height - 1 : this->height)) {
+        throw std::out_of_range("South wall of cell " + std::to_string(x) + ", " + std::to_string(y) + " is out of range");
     }
+
+    this->version++;
+
+    size_t word = static_cast<size_t>(y) * this->rowWords * 2 + this->rowWords + x / 64;
+    uint64_t mask = uint64_t(1) << (x % 64);
+
+    this->bits[word] = open ? (this->bits[word] | mask) : (this->bits[word] & ~mask);
 }
 
 /**
- * @brief Construct a new Graph:: Graph object
- * @param graph Graph to copy
+ * @brief Get the number of 64-bit words holding one row of east (or south) bits
+ * @return Number of words per row and direction
  */
-Graph Graph::clone() {
-    Graph newGraph(this->width, this->height);
+int Grid::getRowWords() const {
+    return this->rowWords;
+}
 
-    for (int y = 0; y < this->height; y++) {
-        for (int x = 0; x < this->width; x++) {
-            std::shared_ptr<Node> node = this->getNode(x, y);
-            std::shared_ptr<Node> newNode = newGraph.getNode(x, y);
+/**
+ * @brief Get the words with east bits of a row for writing, bit x % 64 of word x / 64 belongs to column x.
+ * Bits past the last column and the east bit of the last column must stay zero. The version is bumped
+ * once per call, writes through a pointer kept past the next Maze::getAdjacency() call are not tracked.
+ * @param y Y coordinate of the row
+ * @return Pointer to the first east word of the row
+ */
+uint64_t *Grid::getEastRow(int y) {
+    this->version++;
 
-            newNode->setID(node->getID());
+    return this->bits.data() + static_cast<size_t>(y) * this->rowWords * 2;
+}
 
-            for (const auto &neighbour: node->getNeighbours()) {
-                newNode->addNeighbour(newGraph.getNode(neighbour->getX(), neighbour->getY()));
-            }
-        }
+/**
+ * @brief Get the words with east bits of a row, laid out as in the writable getEastRow()
+ * @param y Y coordinate of the row
+ * @return Pointer to the first east word of the row
+ */
+const uint64_t *Grid::getEastRow(int y) const {
+    return this->bits.data() + static_cast<size_t>(y) * this->rowWords * 2;
+}
+
+/**
+ * @brief Get the words with south bits of a row for writing, laid out as in getEastRow().
+ * Bits past the last column and all south bits of the last row must stay zero.
+ * @param y Y coordinate of the row
+ * @return Pointer to the first south word of the row
+ */
+uint64_t *Grid::getSouthRow(int y) {
+    this->version++;
+
+    return this->bits.data() + static_cast<size_t>(y) * this->rowWords * 2 + this->rowWords;
+}
+
+/**
+ * @brief Get the words with south bits of a row, laid out as in getEastRow()
+ * @param y Y coordinate of the row
+ * @return Pointer to the first south word of the row
+ */
+const uint64_t *Grid::getSouthRow(int y) const {
+    return this->bits.data() + static_cast<size_t>(y) * this->rowWords * 2 + this->rowWords;
+}
+
+/**
+ * @brief Get the words with east bits of a row for writing without bumping the version, for workers
+ * writing rows in parallel. The caller bumps the version once with bumpVersion().
+ * @param y Y coordinate of the row
+ * @return Pointer to the first east word of the row
+ */
+uint64_t *Grid::rawEastRow(int y) {
+    return this->bits.data() + static_cast<size_t>(y) * this->rowWords * 2;
+}
+
+/**
+ * @brief Get the words with south bits of a row for writing without bumping the version, as rawEastRow()
+ * @param y Y coordinate of the row
+ * @return Pointer to the first south word of the row
+ */
+uint64_t *Grid::rawSouthRow(int y) {
+    return this->bits.data() + static_cast<size_t>(y) * this->rowWords * 2 + this->rowWords;
+}
+
+/**
+ * @brief Open the east wall of the cell without bumping the version, for workers carving in parallel.
+ * Workers must not share a word of the grid, the caller bumps the version once with bumpVersion().
+ * @param x X coordinate
+ * @param y Y coordinate
+ */
+void Grid::carveEast(int x, int y) {
+    if (x < 0 || x >= this->width - 1 || y < 0 || y >= this->height) {
+        throw std::out_of_range("East wall of cell " + std::to_string(x) + ", " + std::to_string(y) + " is out of range");
+    }
+
+    this->bits[static_cast<size_t>(y) * this->rowWords * 2 + x / 64] |= uint64_t(1) << (x % 64);
+}
+
+/**
+ * @brief Open the south wall of the cell without bumping the version, as carveEast()
+ * @param x X coordinate
+ * @param y Y coordinate
+ */
+void Grid::carveSouth(int x, int y) {
+    if (x < 0 || x >= this->width || y < 0 || y >= this->height - 1) {
+        throw std::out_of_range("South wall of cell " + std::to_string(x) + ", " + std::to_string(y) + " is out of range");
     }
 
-    return newGraph;
+    this->bits[static_cast<size_t>(y) * this->rowWords * 2 + this->rowWords + x / 64] |= uint64_t(1) << (x % 64);
+}
+
+/**
+ * @brief Mark the grid as changed after writes through the raw accessors or carve functions.
+ * Call it on a single thread, before or after the parallel writes.
+ */
+void Grid::bumpVersion() {
+    this->version++;
+}
+
+/**
+ * @brief Check if the passages of the grid carry weights
+ * @return true if weights are stored
+ */
+bool Grid::isWeighted() const {
+    return !this->weights.empty();
+}
+
+/**
+ * @brief Get the cost of the passage to the east neighbour
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @return Weight of the east passage, 1 for unweighted grids
+ */
+int Grid::getWeightEast(int x, int y) const {
+    return this->weights.empty() ? 1 : this->weights[(static_cast<size_t>(y) * this->width + x) * 2];
+}
+
+/**
+ * @brief Get the cost of the passage to the south neighbour
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @return Weight of the south passage, 1 for unweighted grids
+ */
+int Grid::getWeightSouth(int x, int y) const {
+    return this->weights.empty() ? 1 : this->weights[(static_cast<size_t>(y) * this->width + x) * 2 + 1];
+}
+
+/**
+ * @brief Set the cost of the passage to the east neighbour, the weight storage is created on first use
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @param weight Weight between 1 and 255
+ */
+void Grid::setWeightEast(int x, int y, int weight) {
+    if (weight < 1 || weight > 255) {
+        throw std::out_of_range("Weight " + std::to_string(weight) + " is out of range");
+    }
+
+    if (x < 0 || x >= this->width || y < 0 || y >= this->height) {
+        throw std::out_of_range("Cell " + std::to_string(x) + ", " + std::to_string(y) + " is out of range");
+    }
+
+    this->version++;
+
+    if (this->weights.empty()) {
+        this->weights.assign(static_cast<size_t>(this->size()) * 2, 1);
+    }
+
+    this->weights[(static_cast<size_t>(y) * this->width + x) * 2] = static_cast<uint8_t>(weight);
+}
+
+/**
+ * @brief Set the cost of the passage to the south neighbour, the weight storage is created on first use
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @param weight Weight between 1 and 255
+ */
+void Grid::setWeightSouth(int x, int y, int weight) {
+    if (weight < 1 || weight > 255) {
+        throw std::out_of_range("Weight " + std::to_string(weight) + " is out of range");
+    }
+
+    if (x < 0 || x >= this->width || y < 0 || y >= this->height) {
+        throw std::out_of_range("Cell " + std::to_string(x) + ", " + std::to_string(y) + " is out of range");
+    }
+
+    this->version++;
+
+    if (this->weights.empty()) {
+        this->weights.assign(static_cast<size_t>(this->size()) * 2, 1);
+    }
+
+    this->weights[(static_cast<size_t>(y) * this->width + x) * 2 + 1] = static_cast<uint8_t>(weight);
+}
+
+/**
+ * @brief Drop all weights, every passage costs 1 again
+ */
+void Grid::clearWeights() {
+    this->version++;
+
+    this->weights.clear();
+    this->weights.shrink_to_fit();
+}
+
+/**
+ * @brief Get the version of the grid, it changes whenever a wall or a weight may have changed,
+ * so snapshots built from the grid can tell that they are stale
+ * @return Version of the grid
+ */
+uint64_t Grid::getVersion() const {
+    return this->version;
+}
+
+/**
+ * @brief Get the number of bytes used by the wall bitmap and the weights
+ * @return Memory usage in bytes
+ */
+size_t Grid::getMemoryUsage() const {
+    return this->bits.size() * sizeof(uint64_t) + this->weights.size();
+}
+
+/**
+ * ====================================================
+ */
+
+/**
+ * @brief Construct a new Graph:: Graph object with no passages
+ * @param width Width of the graph
+ * @param height Height of the graph
+ */
+Graph::Graph(int width, int height)
+        : grid(width, height) {
+
+    // empty
+}
+
+/**
+ * @brief Create a copy of the graph
+ * @return Copied graph
+ */
+Graph Graph::clone() const {
+    return *this;
 }
 
 /**
@@ -126,7 +389,7 @@ Graph Graph::clone() {
  * @return Width of the graph
  */
 int Graph::getWidth() const {
-    return this->width;
+    return this->grid.getWidth();
 }
 
 /**
@@ -134,15 +397,48 @@ int Graph::getWidth() const {
  * @return Height of the graph
  */
 int Graph::getHeight() const {
-    return this->height;
+    return this->grid.getHeight();
+}
+
+/**
+ * @brief Get the underlying wall bitmap
+ * @return Grid of the graph
+ */
+const Grid &Graph::getGrid() const {
+    return this->grid;
 }
 
 /**
- * @brief Get the nodes of the graph
+ * @brief Get the underlying wall bitmap
+ * @return Grid of the graph
+ */
+Grid &Graph::getGrid() {
+    return this->grid;
+}
+
+/**
+ * @brief Get a copy of the nodes of the graph in row-major order, prefer getNodeRange()
  * @return Vector of nodes
  */
-std::vector<std::shared_ptr<Node>> Graph::getNodes() {
-    return this->nodes;
+std::vector<Node> Graph::getNodes() const {
+    std::vector<Node> nodes;
+    nodes.reserve(this->size());
+
+    for (int y = 0; y < this->getHeight(); y++) {
+        for (int x = 0; x < this->getWidth(); x++) {
+            nodes.emplace_back(x, y);
+        }
+    }
+
+    return nodes;
+}
+
+/**
+ * @brief Get a range over the nodes of the graph in row-major order
+ * @return Range of nodes
+ */
+NodeRange Graph::getNodeRange() const {
+    return NodeRange(this->getWidth(), this->size());
 }
 
 /**
@@ -150,7 +446,7 @@ std::vector<std::shared_ptr<Node>> Graph::getNodes() {
  * @param coordinate coordinate to get the node at
  * @return Node at the specified coordinates
  */
-std::shared_ptr<Node> Graph::getNode(Coordinate coordinate) {
+Node Graph::getNode(Coordinate coordinate) const {
     return this->getNode(std::get<0>(coordinate), std::get<1>(coordinate));
 }
 
@@ -160,14 +456,191 @@ std::shared_ptr<Node> Graph::getNode(Coordinate coordinate) {
  * @param y Y coordinate
  * @return Node at the specified coordinates
  */
-std::shared_ptr<Node> Graph::getNode(int x, int y) {
-//    for (auto node : this->nodes) {
-//        if (node->getX() == x && node->getY() == y) {
-//            return node;
-//        }
-//    }
+Node Graph::getNode(int x, int y) const {
+    if (x < 0 || x >= this->getWidth() || y < 0 || y >= this->getHeight()) {
+        throw std::out_of_range("Node (" + std::to_string(x) + ", " + std::to_string(y) + ") is out of range");
+    }
+
+    return Node(x, y);
+}
+
+/**
+ * @brief Get the node at the specified row-major index
+ * @param index Index of the node
+ * @return Node at the specified index
+ */
+Node Graph::getNode(int index) const {
+    if (index < 0 || index >= this->size()) {
+        throw std::out_of_range("Node index " + std::to_string(index) + " is out of range");
+    }
+
+    return Node(index % this->getWidth(), index / this->getWidth());
+}
+
+/**
+ * @brief Get the row-major index of the node
+ * @param node Node to get the index of
+ * @return Index of the node
+ */
+int Graph::getIndex(const Node &node) const {
+    return node.getX() + node.getY() * this->getWidth();
+}
+
+/**
+ * @brief Get a copy of the neighbours connected to the node, prefer getNeighbourRange()
+ * @param node Node to get the neighbours of
+ * @return Vector of neighbours
+ */
+std::vector<Node> Graph::getNeighbours(const Node &node) const {
+    NeighbourRange neighbours = this->getNeighbourRange(node);
+
+    return std::vector<Node>(neighbours.begin(), neighbours.end());
+}
+
+/**
+ * @brief Get the neighbours connected to the node, in east, south, west, north order
+ * @param node Node to get the neighbours of
+ * @return Range of neighbours
+ */
+NeighbourRange Graph::getNeighbourRange(const Node &node) const {
+    NeighbourRange neighbours;
+    int x = node.getX();
+    int y = node.getY();
+
+    if (x + 1 < this->getWidth() && this->grid.isOpenEast(x, y)) neighbours.add(x + 1, y);
+    if (y + 1 < this->getHeight() && this->grid.isOpenSouth(x, y)) neighbours.add(x, y + 1);
+    if (x > 0 && this->grid.isOpenEast(x - 1, y)) neighbours.add(x - 1, y);
+    if (y > 0 && this->grid.isOpenSouth(x, y - 1)) neighbours.add(x, y - 1);
+
+    return neighbours;
+}
 
-    return this->nodes.at(x + y * width);
+/**
+ * @brief Get the number of passages leading out of the node
+ * @param node Node to get the degree of
+ * @return Degree of the node
+ */
+int Graph::getDegree(const Node &node) const {
+    int x = node.getX();
+    int y = node.getY();
+
+    return (x + 1 < this->getWidth() && this->grid.isOpenEast(x, y)) +
+           (y + 1 < this->getHeight() && this->grid.isOpenSouth(x, y)) +
+           (x > 0 && this->grid.isOpenEast(x - 1, y)) +
+           (y > 0 && this->grid.isOpenSouth(x, y - 1));
+}
+
+/**
+ * @brief Check if there is a passage between two nodes
+ * @param a First node
+ * @param b Second node
+ * @return true if the nodes are adjacent and connected
+ */
+bool Graph::isConnected(const Node &a, const Node &b) const {
+    if (a.getY() == b.getY() && std::abs(a.getX() - b.getX()) == 1) {
+        return this->grid.isOpenEast(std::min(a.getX(), b.getX()), a.getY());
+    }
+
+    if (a.getX() == b.getX() && std::abs(a.getY() - b.getY()) == 1) {
+        return this->grid.isOpenSouth(a.getX(), std::min(a.getY(), b.getY()));
+    }
+
+    return false;
+}
+
+/**
+ * @brief Open the wall between two adjacent nodes
+ * @param a First node
+ * @param b Second node
+ * @return false if the nodes are not adjacent
+ */
+bool Graph::connect(const Node &a, const Node &b) {
+    if (a.getY() == b.getY() && std::abs(a.getX() - b.getX()) == 1) {
+        this->grid.setOpenEast(std::min(a.getX(), b.getX()), a.getY(), true);
+        return true;
+    }
+
+    if (a.getX() == b.getX() && std::abs(a.getY() - b.getY()) == 1) {
+        this->grid.setOpenSouth(a.getX(), std::min(a.getY(), b.getY()), true);
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Close the wall between two adjacent nodes
+ * @param a First node
+ * @param b Second node
+ * @return false if the nodes are not adjacent
+ */
+bool Graph::disconnect(const Node &a, const Node &b) {
+    if (a.getY() == b.getY() && std::abs(a.getX() - b.getX()) == 1) {
+        this->grid.setOpenEast(std::min(a.getX(), b.getX()), a.getY(), false);
+        return true;
+    }
+
+    if (a.getX() == b.getX() && std::abs(a.getY() - b.getY()) == 1) {
+        this->grid.setOpenSouth(a.getX(), std::min(a.getY(), b.getY()), false);
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Get the version of the graph, it changes whenever a passage or a weight may have changed
+ * @return Version of the graph
+ */
+uint64_t Graph::getVersion() const {
+    return this->grid.getVersion();
+}
+
+/**
+ * @brief Check if the passages of the graph carry weights
+ * @return true if weights are stored
+ */
+bool Graph::isWeighted() const {
+    return this->grid.isWeighted();
+}
+
+/**
+ * @brief Get the cost of moving between two adjacent nodes
+ * @param a First node
+ * @param b Second node
+ * @return Weight of the passage, 0 if the nodes are not adjacent
+ */
+int Graph::getWeight(const Node &a, const Node &b) const {
+    if (a.getY() == b.getY() && std::abs(a.getX() - b.getX()) == 1) {
+        return this->grid.getWeightEast(std::min(a.getX(), b.getX()), a.getY());
+    }
+
+    if (a.getX() == b.getX() && std::abs(a.getY() - b.getY()) == 1) {
+        return this->grid.getWeightSouth(a.getX(), std::min(a.getY(), b.getY()));
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Set the cost of moving between two adjacent nodes
+ * @param a First node
+ * @param b Second node
+ * @param weight Weight between 1 and 255
+ * @return false if the nodes are not adjacent
+ */
+bool Graph::setWeight(const Node &a, const Node &b, int weight) {
+    if (a.getY() == b.getY() && std::abs(a.getX() - b.getX()) == 1) {
+        this->grid.setWeightEast(std::min(a.getX(), b.getX()), a.getY(), weight);
+        return true;
+    }
+
+    if (a.getX() == b.getX() && std::abs(a.getY() - b.getY()) == 1) {
+        this->grid.setWeightSouth(a.getX(), std::min(a.getY(), b.getY()), weight);
+        return true;
+    }
+
+    return false;
 }
 
 /**
@@ -175,5 +648,377 @@ std::shared_ptr<Node> Graph::getNode(int x, int y) {
  * @return Size of the graph
  */
 int Graph::size() const {
-    return static_cast<int>(this->nodes.size());
-}
\ No newline at end of file
+    return this->grid.size();
+}
+
+/**
+ * ====================================================
+ */
+
+/**
+ * @brief Build a CSR snapshot of the graph passages
+ * @param graph Graph to build the snapshot from
+ */
+Adjacency::Adjacency(const Graph &graph) {
+    const Grid &grid = graph.getGrid();
+
+    this->width = graph.getWidth();
+    this->height = graph.getHeight();
+
+    this->offsets.reserve(static_cast<size_t>(graph.size()) + 1);
+    this->targets.reserve(static_cast<size_t>(graph.size()) * 2);
+
+    bool weighted = grid.isWeighted();
+
+    if (weighted) {
+        this->weights.reserve(static_cast<size_t>(graph.size()) * 2);
+    }
+
+    for (int y = 0; y < this->height; y++) {
+        for (int x = 0; x < this->width; x++) {
+            uint32_t index = x + y * this->width;
+
+            this->offsets.push_back(static_cast<uint32_t>(this->targets.size()));
+
+            if (x + 1 < this->width && grid.isOpenEast(x, y)) this->targets.push_back(index + 1);
+            if (y + 1 < this->height && grid.isOpenSouth(x, y)) this->targets.push_back(index + this->width);
+            if (x > 0 && grid.isOpenEast(x - 1, y)) this->targets.push_back(index - 1);
+            if (y > 0 && grid.isOpenSouth(x, y - 1)) this->targets.push_back(index - this->width);
+
+            if (!weighted) {
+                continue;
+            }
+
+            // Weights in the same order as the targets
+            if (x + 1 < this->width && grid.isOpenEast(x, y)) this->weights.push_back(grid.getWeightEast(x, y));
+            if (y + 1 < this->height && grid.isOpenSouth(x, y)) this->weights.push_back(grid.getWeightSouth(x, y));
+            if (x > 0 && grid.isOpenEast(x - 1, y)) this->weights.push_back(grid.getWeightEast(x - 1, y));
+            if (y > 0 && grid.isOpenSouth(x, y - 1)) this->weights.push_back(grid.getWeightSouth(x, y - 1));
+        }
+    }
+
+    this->offsets.push_back(static_cast<uint32_t>(this->targets.size()));
+
+    if (!this->weights.empty()) {
+        this->minWeight = *std::min_element(this->weights.begin(), this->weights.end());
+    }
+}
+
+/**
+ * @brief Get the width of the snapshot
+ * @return Width of the graph
+ */
+int Adjacency::getWidth() const {
+    return this->width;
+}
+
+/**
+ * @brief Get the height of the snapshot
+ * @return Height of the graph
+ */
+int Adjacency::getHeight() const {
+    return this->height;
+}
+
+/**
+ * @brief Get the number of cells in the snapshot
+ * @return Number of cells
+ */
+int Adjacency::size() const {
+    return this->width * this->height;
+}
+
+/**
+ * @brief Get the row offsets, one per cell plus a trailing end offset
+ * @return Offsets into the targets array
+ */
+const std::vector<uint32_t> &Adjacency::getOffsets() const {
+    return this->offsets;
+}
+
+/**
+ * @brief Get the flat array of neighbour indices
+ * @return Neighbour indices
+ */
+const std::vector<uint32_t> &Adjacency::getTargets() const {
+    return this->targets;
+}
+
+/**
+ * @brief Check if the snapshot carries passage weights
+ * @return true if weights are stored
+ */
+bool Adjacency::isWeighted() const {
+    return !this->weights.empty();
+}
+
+/**
+ * @brief Get the flat array of passage weights, aligned with the targets, empty for unweighted graphs
+ * @return Passage weights
+ */
+const std::vector<uint8_t> &Adjacency::getWeights() const {
+    return this->weights;
+}
+
+/**
+ * @brief Get the lowest weight of any passage, a lower bound on the cost of every step
+ * @return Lowest passage weight, 1 for unweighted graphs
+ */
+int Adjacency::getMinWeight() const {
+    return this->minWeight;
+}
+
+/**
+ * @brief Get the number of passages leading out of the cell
+ * @param index Index of the cell
+ * @return Degree of the cell
+ */
+int Adjacency::getDegree(int index) const {
+    return static_cast<int>(this->offsets[index + 1] - this->offsets[index]);
+}
+
+
+/**
+ * ====================================================
+ */
+
+/**
+ * @brief Build the junction graph by walking every corridor of the snapshot once
+ * @param adjacency Snapshot of the maze passages
+ */
+JunctionGraph::JunctionGraph(const Adjacency &adjacency) {
+    const std::vector<uint32_t> &cellOffsets = adjacency.getOffsets();
+    const std::vector<uint32_t> &cellTargets = adjacency.getTargets();
+    const std::vector<uint8_t> &weights = adjacency.getWeights();
+    bool weighted = adjacency.isWeighted();
+
+    const uint32_t unset = 0xFFFFFFFFu;
+    uint32_t size = static_cast<uint32_t>(adjacency.size());
+
+    this->locations.assign(size, unset);
+    this->corridorStarts.push_back(0);
+
+    // Every cell which is not in the middle of a corridor is a junction
+    for (uint32_t cell = 0; cell < size; cell++) {
+        if (adjacency.getDegree(static_cast<int>(cell)) != 2) {
+            this->locations[cell] = static_cast<uint32_t>(this->cells.size());
+            this->cells.push_back(cell);
+        }
+    }
+
+    // Walk the corridor leaving a junction cell through a passage, corridors already walked from their other
+    // end are skipped, as are passages straight to a junction with a lower index
+    auto walk = [&](uint32_t from, uint32_t passage) {
+        uint32_t previous = from;
+        uint32_t current = cellTargets[passage];
+        uint32_t cost = weighted ? weights[passage] : 1;
+
+        if (this->locations[current] != unset && ((this->locations[current] & CORRIDOR) || current < from)) {
+            return;
+        }
+
+        uint32_t corridor = static_cast<uint32_t>(this->corridorStarts.size() - 1);
+
+        while (this->locations[current] == unset) {
+            this->locations[current] = CORRIDOR | corridor;
+            this->corridorCells.push_back(current);
+            this->corridorCosts.push_back(cost);
+
+            // Leave through the passage which does not lead back
+            uint32_t next = cellOffsets[current];
+            if (cellTargets[next] == previous) next++;
+
+            cost += weighted ? weights[next] : 1;
+            previous = current;
+            current = cellTargets[next];
+        }
+
+        // The cell of the second end closes the corridor, with the total cost
+        this->corridorCells.push_back(current);
+        this->corridorCosts.push_back(cost);
+        this->corridorEnds.push_back(this->locations[from]);
+        this->corridorEnds.push_back(this->locations[current]);
+        this->corridorStarts.push_back(static_cast<uint32_t>(this->corridorCells.size()));
+    };
+
+    for (uint32_t junction = 0, count = static_cast<uint32_t>(this->cells.size()); junction < count; junction++) {
+        uint32_t cell = this->cells[junction];
+
+        for (uint32_t passage = cellOffsets[cell]; passage < cellOffsets[cell + 1]; passage++) {
+            walk(cell, passage);
+        }
+    }
+
+    // Corridor loops without any junction get one on their first cell
+    for (uint32_t cell = 0; cell < size; cell++) {
+        if (this->locations[cell] == unset) {
+            this->locations[cell] = static_cast<uint32_t>(this->cells.size());
+            this->cells.push_back(cell);
+
+            walk(cell, cellOffsets[cell]);
+        }
+    }
+
+    // Both directions of every corridor between two different junctions become edges
+    int junctions = this->size();
+    int corridors = this->getCorridorCount();
+
+    this->offsets.assign(static_cast<size_t>(junctions) + 1, 0);
+
+    for (int corridor = 0; corridor < corridors; corridor++) {
+        uint32_t first = this->corridorEnds[corridor * 2];
+        uint32_t second = this->corridorEnds[corridor * 2 + 1];
+
+        if (first != second) {
+            this->offsets[first + 1]++;
+            this->offsets[second + 1]++;
+        }
+    }
+
+    for (int junction = 0; junction < junctions; junction++) {
+        this->offsets[junction + 1] += this->offsets[junction];
+    }
+
+    std::vector<uint32_t> fill(this->offsets.begin(), this->offsets.end() - 1);
+
+    this->targets.resize(this->offsets.back());
+    this->costs.resize(this->offsets.back());
+    this->edgeCorridors.resize(this->offsets.back());
+
+    for (int corridor = 0; corridor < corridors; corridor++) {
+        uint32_t first = this->corridorEnds[corridor * 2];
+        uint32_t second = this->corridorEnds[corridor * 2 + 1];
+        uint32_t cost = this->corridorCosts[this->corridorStarts[corridor + 1] - 1];
+
+        if (first == second) {
+            continue;
+        }
+
+        uint32_t edge = fill[first]++;
+        this->targets[edge] = second;
+        this->costs[edge] = cost;
+        this->edgeCorridors[edge] = static_cast<uint32_t>(corridor);
+
+        edge = fill[second]++;
+        this->targets[edge] = first;
+        this->costs[edge] = cost;
+        this->edgeCorridors[edge] = static_cast<uint32_t>(corridor) | REVERSED;
+    }
+}
+
+/**
+ * @brief Get the number of junctions
+ * @return Number of junctions
+ */
+int JunctionGraph::size() const {
+    return static_cast<int>(this->cells.size());
+}
+
+/**
+ * @brief Get the number of corridors, including the ones without an edge
+ * @return Number of corridors
+ */
+int JunctionGraph::getCorridorCount() const {
+    return static_cast<int>(this->corridorStarts.size()) - 1;
+}
+
+/**
+ * @brief Get the cell of every junction
+ * @return Cell indices
+ */
+const std::vector<uint32_t> &JunctionGraph::getCells() const {
+    return this->cells;
+}
+
+/**
+ * @brief Get the location of every cell, its junction or CORRIDOR with the index of its corridor
+ * @return Locations
+ */
+const std::vector<uint32_t> &JunctionGraph::getLocations() const {
+    return this->locations;
+}
+
+/**
+ * @brief Get the edge offsets, one per junction plus a trailing end offset
+ * @return Offsets into the edge arrays
+ */
+const std::vector<uint32_t> &JunctionGraph::getOffsets() const {
+    return this->offsets;
+}
+
+/**
+ * @brief Get the junction at the other end of every edge
+ * @return Target junctions
+ */
+const std::vector<uint32_t> &JunctionGraph::getTargets() const {
+    return this->targets;
+}
+
+/**
+ * @brief Get the cost of every edge, the sum of the passage weights along its corridor
+ * @return Edge costs
+ */
+const std::vector<uint32_t> &JunctionGraph::getCosts() const {
+    return this->costs;
+}
+
+/**
+ * @brief Get the corridor of every edge, flagged REVERSED when the edge walks it from its second end
+ * @return Edge corridors
+ */
+const std::vector<uint32_t> &JunctionGraph::getEdgeCorridors() const {
+    return this->edgeCorridors;
+}
+
+/**
+ * @brief Get the corridor offsets into the corridor cells, one per corridor plus a trailing end offset
+ * @return Corridor offsets
+ */
+const std::vector<uint32_t> &JunctionGraph::getCorridorStarts() const {
+    return this->corridorStarts;
+}
+
+/**
+ * @brief Get the inner cells of every corridor from its first end, each followed by the cell of its second end
+ * @return Corridor cells
+ */
+const std::vector<uint32_t> &JunctionGraph::getCorridorCells() const {
+    return this->corridorCells;
+}
+
+/**
+ * @brief Get the cost of reaching every corridor cell from the first end of its corridor
+ * @return Corridor costs, aligned with the corridor cells
+ */
+const std::vector<uint32_t> &JunctionGraph::getCorridorCosts() const {
+    return this->corridorCosts;
+}
+
+/**
+ * @brief Get the first and the second end junction of every corridor
+ * @return Two junctions per corridor
+ */
+const std::vector<uint32_t> &JunctionGraph::getCorridorEnds() const {
+    return this->corridorEnds;
+}
+
+/**
+ * @brief Append the inner cells of the corridor of an edge in walking order, without the junctions at its ends
+ * @param edge Index of the edge
+ * @param path Cells to append to
+ */
+void JunctionGraph::expandEdge(int edge, std::vector<uint32_t> &path) const {
+    uint32_t corridor = this->edgeCorridors[edge] & ~REVERSED;
+    uint32_t first = this->corridorStarts[corridor];
+    uint32_t last = this->corridorStarts[corridor + 1] - 1;
+
+    if (this->edgeCorridors[edge] & REVERSED) {
+        for (uint32_t i = last; i > first; i--) {
+            path.push_back(this->corridorCells[i - 1]);
+        }
+    } else {
+        for (uint32_t i = first; i < last; i++) {
+            path.push_back(this->corridorCells[i]);
+        }
+    }
+}
@@ -4,6 +4,10 @@
 #include <string>
 #include <memory>
 #include <tuple>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <stdexcept>
 #include <iostream>
 
 typedef std::tuple<int, int> Coordinate;
@@ -12,11 +16,10 @@ class Node {
 private:
     int x;
     int y;
-    int id;
-
-    std::vector<std::shared_ptr<Node>> neighbours;
 
 public:
+    Node();
+
     Node(int x, int y);
 
     ~Node() = default;
@@ -25,41 +28,306 @@ public:
 
     int getY() const;
 
-    void setID(int id);
+    bool operator==(const Node &other) const;
+
+    bool operator!=(const Node &other) const;
+};
+
+/**
+ * @brief Packed wall bitmap of a rectangular maze.
+ *
+ * Every cell owns two bits, "open to the east" and "open to the south". West and north
+ * passages are read from the neighbouring cell. Each row starts on a 64-bit word boundary
+ * and keeps its east bits followed by its south bits, so rows never share a word.
+ *
+ * Passages may optionally carry a cost between 1 and 255, stored as one byte per cell and
+ * direction. Unweighted grids keep no weight storage and every passage costs 1.
+ *
+ * Every write through the checked setters and writable row accessors bumps the version. Parallel
+ * writers use the raw accessors and carve functions instead, which leave the version alone, and
+ * call bumpVersion() once on the calling thread.
+ */
+class Grid {
+private:
+    int width;
+    int height;
+    int rowWords;
+    uint64_t version = 0;
+
+    std::vector<uint64_t> bits;
+    std::vector<uint8_t> weights;
+
+public:
+    Grid(int width, int height);
+
+    ~Grid() = default;
+
+    int getWidth() const;
+
+    int getHeight() const;
+
+    int size() const;
+
+    bool isOpenEast(int x, int y) const;
+
+    bool isOpenSouth(int x, int y) const;
+
+    void setOpenEast(int x, int y, bool open);
+
+    void setOpenSouth(int x, int y, bool open);
+
+    int getRowWords() const;
+
+    uint64_t *getEastRow(int y);
+
+    const uint64_t *getEastRow(int y) const;
+
+    uint64_t *getSouthRow(int y);
+
+    const uint64_t *getSouthRow(int y) const;
+
+    uint64_t *rawEastRow(int y);
+
+    uint64_t *rawSouthRow(int y);
+
+    void carveEast(int x, int y);
 
-    int getID() const;
+    void carveSouth(int x, int y);
 
-    void addNeighbour(std::shared_ptr<Node> node);
+    void bumpVersion();
 
-    std::vector<std::shared_ptr<Node>> getNeighbours();
+    bool isWeighted() const;
 
-    void clearNeighbours();
+    int getWeightEast(int x, int y) const;
 
+    int getWeightSouth(int x, int y) const;
+
+    void setWeightEast(int x, int y, int weight);
+
+    void setWeightSouth(int x, int y, int weight);
+
+    void clearWeights();
+
+    uint64_t getVersion() const;
+
+    size_t getMemoryUsage() const;
+};
+
+/**
+ * @brief Range over all nodes of a graph in row-major order, without building a container.
+ */
+class NodeRange {
+public:
+    class Iterator {
+    private:
+        int index;
+        int x;
+        int y;
+        int width;
+
+    public:
+        Iterator(int index, int width) : index(index), x(0), y(0), width(width) {};
+
+        Node operator*() const { return Node(this->x, this->y); }
+
+        Iterator &operator++() {
+            this->index++;
+
+            if (++this->x == this->width) {
+                this->x = 0;
+                this->y++;
+            }
+
+            return *this;
+        }
+
+        bool operator!=(const Iterator &other) const { return this->index != other.index; }
+    };
+
+private:
+    int width;
+    int count;
+
+public:
+    NodeRange(int width, int count) : width(width), count(count) {};
+
+    Iterator begin() const { return Iterator(0, this->width); }
+
+    Iterator end() const { return Iterator(this->count, this->width); }
+
+    int size() const { return this->count; }
+};
+
+/**
+ * @brief Fixed-capacity range of up to four neighbours, stored inline.
+ */
+class NeighbourRange {
+private:
+    Node nodes[4];
+    int count = 0;
+
+public:
+    NeighbourRange() = default;
+
+    void add(int x, int y) { this->nodes[this->count++] = Node(x, y); }
+
+    const Node *begin() const { return this->nodes; }
+
+    const Node *end() const { return this->nodes + this->count; }
+
+    int size() const { return this->count; }
 };
 
 class Graph {
+private:
+    Grid grid;
+
+public:
+    Graph(int width, int height);
+
+    ~Graph() = default;
+
+    int getWidth() const;
+
+    int getHeight() const;
+
+    const Grid &getGrid() const;
+
+    Grid &getGrid();
+
+    std::vector<Node> getNodes() const;
+
+    NodeRange getNodeRange() const;
+
+    Node getNode(Coordinate coordinate) const;
+
+    Node getNode(int x, int y) const;
+
+    Node getNode(int index) const;
+
+    int getIndex(const Node &node) const;
+
+    std::vector<Node> getNeighbours(const Node &node) const;
+
+    NeighbourRange getNeighbourRange(const Node &node) const;
+
+    int getDegree(const Node &node) const;
+
+    bool isConnected(const Node &a, const Node &b) const;
+
+    bool connect(const Node &a, const Node &b);
+
+    bool disconnect(const Node &a, const Node &b);
+
+    uint64_t getVersion() const;
+
+    bool isWeighted() const;
+
+    int getWeight(const Node &a, const Node &b) const;
+
+    bool setWeight(const Node &a, const Node &b, int weight);
+
+    int size() const;
+
+    Graph clone() const;
+};
+
+/**
+ * @brief Read-only CSR (compressed sparse row) snapshot of the graph passages.
+ *
+ * Neighbours of the cell with index i are targets[offsets[i]] .. targets[offsets[i + 1] - 1],
+ * stored in east, south, west, north order. Weighted graphs also keep the cost of every
+ * passage in weights, aligned with targets.
+ */
+class Adjacency {
 private:
     int width;
     int height;
 
-    std::vector<std::shared_ptr<Node>> nodes;
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> targets;
+    std::vector<uint8_t> weights;
+    int minWeight = 1;
 
 public:
-    Graph(int width, int height);
+    explicit Adjacency(const Graph &graph);
 
-    ~Graph();
+    ~Adjacency() = default;
 
     int getWidth() const;
 
     int getHeight() const;
 
-    std::vector<std::shared_ptr<Node>> getNodes();
+    int size() const;
+
+    const std::vector<uint32_t> &getOffsets() const;
+
+    const std::vector<uint32_t> &getTargets() const;
+
+    bool isWeighted() const;
 
-    std::shared_ptr<Node> getNode(Coordinate coordinate);
+    const std::vector<uint8_t> &getWeights() const;
 
-    std::shared_ptr<Node> getNode(int x, int y);
+    int getMinWeight() const;
+
+    int getDegree(int index) const;
+};
+
+/**
+ * @brief Junction graph of a maze, every corridor of degree 2 cells is collapsed into a single weighted edge.
+ *
+ * Nodes are the junctions and dead ends, and one cell of every corridor loop that has no junction at all.
+ * Each corridor keeps its inner cells from its first to its second end, with the cost of reaching every
+ * inner cell from the first end, so paths found on the junction graph can be expanded back into cells.
+ * Edges are stored as CSR like Adjacency, corridors that lead back to their own junction get no edge.
+ */
+class JunctionGraph {
+private:
+    std::vector<uint32_t> cells;
+    std::vector<uint32_t> locations;
+
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> targets;
+    std::vector<uint32_t> costs;
+    std::vector<uint32_t> edgeCorridors;
+
+    std::vector<uint32_t> corridorStarts;
+    std::vector<uint32_t> corridorCells;
+    std::vector<uint32_t> corridorCosts;
+    std::vector<uint32_t> corridorEnds;
+
+public:
+    // Location flag of corridor cells, and edge flag of corridors walked from their second end
+    static constexpr uint32_t CORRIDOR = 0x80000000u;
+    static constexpr uint32_t REVERSED = 0x80000000u;
+
+    explicit JunctionGraph(const Adjacency &adjacency);
+
+    ~JunctionGraph() = default;
 
     int size() const;
 
-    Graph clone();
+    int getCorridorCount() const;
+
+    const std::vector<uint32_t> &getCells() const;
+
+    const std::vector<uint32_t> &getLocations() const;
+
+    const std::vector<uint32_t> &getOffsets() const;
+
+    const std::vector<uint32_t> &getTargets() const;
+
+    const std::vector<uint32_t> &getCosts() const;
+
+    const std::vector<uint32_t> &getEdgeCorridors() const;
+
+    const std::vector<uint32_t> &getCorridorStarts() const;
+
+    const std::vector<uint32_t> &getCorridorCells() const;
+
+    const std::vector<uint32_t> &getCorridorCosts() const;
+
+    const std::vector<uint32_t> &getCorridorEnds() const;
+
+    void expandEdge(int edge, std::vector<uint32_t> &path) const;
 };
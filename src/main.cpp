@@ -19,6 +19,8 @@
 #include <variant>
 #include <chrono>
 #include <iomanip>
+#include <atomic>
+#include <mutex>
 
 #include "headers/Expected.h"
 
@@ -84,6 +86,12 @@ int main(int argc, char **argv) {
                                .addArguments({"double"})
                                .setDescription("Seed of the maze")
             )
+            .addOption(Option("threads")
+                               .addAliases({"-t", "--threads"})
+                               .addArguments({"int"})
+                               .setDescription("Threads used by parallel generators, 0 for all")
+                               .setDefaults({0})
+            )
             .addOption(Option("start")
                                .addAliases({"-s", "--start"})
                                .addArguments({"int", "int"})
@@ -118,6 +126,30 @@ int main(int argc, char **argv) {
                                .addArguments({"string"})
                                .setDescription("Path to the image, where maze will be saved")
             )
+            .addOption(Option("braid")
+                               .addAliases({"-b", "--braid"})
+                               .addArguments({"double"})
+                               .setDescription("Fraction of dead ends removed to create loops")
+            )
+            .addOption(Option("loops")
+                               .addAliases({"-l", "--loops"})
+                               .addArguments({"double"})
+                               .setDescription("Fraction of closed walls opened to create loops")
+            )
+            .addOption(Option("weights")
+                               .addAliases({"-we", "--weights"})
+                               .addArguments({"int", "int"})
+                               .setDescription("Largest passage cost and terrain scale in cells")
+            )
+            .addOption(Option("stream")
+                               .addAliases({"-st", "--stream"})
+                               .setDescription("Write rows straight to file, maze is not kept in memory (Eller)")
+            )
+            .addOption(Option("count")
+                               .addAliases({"-n", "--count"})
+                               .addArguments({"int"})
+                               .setDescription("Number of mazes generated in parallel into numbered files")
+            )
             .returns(
                     [=](std::map<std::string, std::optional<std::vector<std::variant<int, double, bool, std::string, std::nullopt_t>>>> map) {
 
@@ -152,6 +184,213 @@ int main(int argc, char **argv) {
                             return 1;
                         }
 
+                        // Set worker threads of parallel generators
+                        generatingAlgorithm->setThreads(std::get<int>(map["threads"].value()[0]));
+
+                        cout << " mazelib:  - Threads: " << generatingAlgorithm->getThreads() << endl;
+
+                        // Stream the maze straight to the file
+                        if (std::get<bool>(map["stream"].value()[0])) {
+                            std::shared_ptr<EllersAlgorithm> streamingAlgorithm = std::dynamic_pointer_cast<EllersAlgorithm>(
+                                    generatingAlgorithm);
+
+                            if (streamingAlgorithm == nullptr) {
+                                cout << " mazelib:     - Streaming is supported only by Eller's algorithm. " << endl;
+                                return 1;
+                            }
+
+                            if (!map["file"].has_value()) {
+                                cout << " mazelib:     - Streaming requires an output file. " << endl;
+                                return 1;
+                            }
+
+                            // These need the whole graph, which is never kept in memory while streaming
+                            for (const char *option: {"image", "braid", "loops", "weights"}) {
+                                if (map[option].has_value()) {
+                                    cout << " mazelib:     - Streaming does not support the " << option << " option. "
+                                         << endl;
+                                    return 1;
+                                }
+                            }
+
+                            std::string file = std::get<std::string>(map["file"].value()[0]);
+                            Coordinate start = {std::get<int>(map["start"].value()[0]),
+                                                std::get<int>(map["start"].value()[1])};
+                            Coordinate end = {std::get<int>(map["end"].value()[0]),
+                                              std::get<int>(map["end"].value()[1])};
+
+                            if (end == Coordinate(-1, -1)) {
+                                end = {width - 1, height - 1};
+                            }
+
+                            int pathWidth = std::get<int>(map["pathWidth"].value()[0]);
+                            int wallWidth = std::get<int>(map["wallWidth"].value()[0]);
+
+                            cout << " mazelib:  - Start: (" << std::get<0>(start) << ", " << std::get<1>(start) << ")"
+                                 << endl;
+                            cout << " mazelib:  - End: (" << std::get<0>(end) << ", " << std::get<1>(end) << ")"
+                                 << endl;
+                            cout << " mazelib:  - Wall Width: " << wallWidth << endl;
+                            cout << " mazelib:  - Path Width: " << pathWidth << endl;
+
+                            cout << endl;
+                            cout << " mazelib: Gathering output:" << endl;
+                            cout << " mazelib:  - File Path: " << file << endl;
+
+                            Expected<int> status = streamingAlgorithm->generateToFile(width, height, start, end,
+                                                                                      pathWidth, wallWidth, file);
+
+                            if (status.hasError()) {
+                                cout << " mazelib:     - File saving failed. Error: " << status.error() << endl;
+                                return 1;
+                            }
+
+                            cout << " mazelib:     - File saved successfully!" << endl;
+
+                            auto endTime = std::chrono::high_resolution_clock::now();
+                            auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    endTime - startTime).count();
+
+                            cout << endl << " mazelib: Maze generated successfully! Took: " << (duration / 1000) << "us"
+                                 << endl;
+                            cout << "" << endl;
+
+                            return 0;
+                        }
+
+                        // Generate a batch of mazes into numbered files, maze_0.json, maze_1.json, ...
+                        if (map["count"].has_value()) {
+                            int count = std::get<int>(map["count"].value()[0]);
+
+                            if (!map["file"].has_value()) {
+                                cout << " mazelib:     - Batch generation requires an output file. " << endl;
+                                return 1;
+                            }
+
+                            std::string file = std::get<std::string>(map["file"].value()[0]);
+                            std::optional<std::string> image;
+                            std::atomic<int> failed(0);
+                            std::vector<std::string> errors;
+                            std::mutex errorsMutex;
+
+                            if (map["image"].has_value()) {
+                                image = std::get<std::string>(map["image"].value()[0]);
+                            }
+
+                            // Number a path before its extension, dots of directory names are not extensions
+                            auto getNumberedPath = [](const std::string &path, int index) {
+                                size_t separator = path.find_last_of("/\\");
+                                size_t extension = path.rfind('.');
+                                size_t name = separator == std::string::npos ? 0 : separator + 1;
+
+                                if (extension == std::string::npos || extension <= name) {
+                                    return path + "_" + std::to_string(index);
+                                }
+
+                                return path.substr(0, extension) + "_" + std::to_string(index) + path.substr(extension);
+                            };
+
+                            // Options are read up front, the sink runs on the worker threads
+                            double braid = map["braid"].has_value() ? std::get<double>(map["braid"].value()[0]) : 0;
+                            double loops = map["loops"].has_value() ? std::get<double>(map["loops"].value()[0]) : 0;
+                            bool weighted = map["weights"].has_value();
+                            int maxWeight = weighted ? std::get<int>(map["weights"].value()[0]) : 1;
+                            int scale = weighted ? std::get<int>(map["weights"].value()[1]) : 1;
+                            int pathWidth = std::get<int>(map["pathWidth"].value()[0]);
+                            int wallWidth = std::get<int>(map["wallWidth"].value()[0]);
+                            Coordinate start = {std::get<int>(map["start"].value()[0]),
+                                                std::get<int>(map["start"].value()[1])};
+                            Coordinate end = {std::get<int>(map["end"].value()[0]),
+                                              std::get<int>(map["end"].value()[1])};
+
+                            if (end == Coordinate(-1, -1)) {
+                                end = {width - 1, height - 1};
+                            }
+
+                            cout << " mazelib:  - Start: (" << std::get<0>(start) << ", " << std::get<1>(start) << ")"
+                                 << endl;
+                            cout << " mazelib:  - End: (" << std::get<0>(end) << ", " << std::get<1>(end) << ")"
+                                 << endl;
+
+                            cout << endl;
+                            cout << " mazelib: Gathering output:" << endl;
+                            cout << " mazelib:  - Mazes: " << count << endl;
+                            cout << " mazelib:  - File Path: " << getNumberedPath(file, 0) << ", ..." << endl;
+
+                            if (image.has_value()) {
+                                cout << " mazelib:  - Image Path: " << getNumberedPath(image.value(), 0) << ", ..."
+                                     << endl;
+                            }
+
+                            generatingAlgorithm->generateBatch(count, width, height, seed,
+                                                               std::get<int>(map["threads"].value()[0]),
+                                                               [&](int index, Expected<MazeBuilder> &expected) {
+                                // Keep the errors of the first failed maze for the report
+                                auto fail = [&](const std::vector<std::string> &mazeErrors) {
+                                    std::lock_guard<std::mutex> lock(errorsMutex);
+
+                                    if (failed++ == 0) {
+                                        errors = mazeErrors;
+                                    }
+                                };
+
+                                if (expected.hasError()) {
+                                    fail(expected.errors());
+                                    return;
+                                }
+
+                                MazeBuilder builder = expected.value();
+
+                                if (braid > 0) builder.removeDeadEnds(braid);
+                                if (loops > 0) builder.removeWalls(loops);
+                                if (weighted) builder.addWeights(maxWeight, scale);
+
+                                builder.setPathWidth(pathWidth);
+                                builder.setWallWidth(wallWidth);
+                                builder.setStart(start);
+                                builder.setEnd(end);
+
+                                Expected<Maze> maze = builder.buildExpected();
+
+                                if (maze.hasError()) {
+                                    fail(maze.errors());
+                                    return;
+                                }
+
+                                Expected<int> status = TextFileSavingMethod().save(maze.value(),
+                                                                                   getNumberedPath(file, index));
+
+                                if (!status.hasError() && image.has_value()) {
+                                    status = ImageSavingMethod().save(maze.value(), getNumberedPath(image.value(), index));
+                                }
+
+                                if (status.hasError()) {
+                                    fail(status.errors());
+                                }
+                            });
+
+                            auto endTime = std::chrono::high_resolution_clock::now();
+                            auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    endTime - startTime).count();
+
+                            if (failed > 0) {
+                                cout << " mazelib:     - " << failed << " mazes failed." << endl;
+                                cout << " mazelib:   - Errors: " << endl;
+
+                                for (const auto &error: errors) {
+                                    cout << " mazelib:      - " << error << endl;
+                                }
+
+                                return 1;
+                            }
+
+                            cout << endl << " mazelib: Mazes generated successfully! Took: " << (duration / 1000) << "us"
+                                 << endl;
+                            cout << "" << endl;
+
+                            return 0;
+                        }
+
                         Expected<MazeBuilder> expectedBuilder = generatingAlgorithm->generate(width, height);
 
                         // Check if maze generation failed
@@ -169,6 +408,32 @@ int main(int argc, char **argv) {
 
                         MazeBuilder builder = expectedBuilder.value();
 
+                        // Remove dead ends to create loops
+                        if (map["braid"].has_value()) {
+                            double braid = std::get<double>(map["braid"].value()[0]);
+                            int removed = builder.removeDeadEnds(braid);
+
+                            cout << " mazelib:  - Braid: " << braid << " (" << removed << " dead ends removed)" << endl;
+                        }
+
+                        // Open random walls to create loops
+                        if (map["loops"].has_value()) {
+                            double loops = std::get<double>(map["loops"].value()[0]);
+                            int opened = builder.removeWalls(loops);
+
+                            cout << " mazelib:  - Loops: " << loops << " (" << opened << " walls opened)" << endl;
+                        }
+
+                        // Give passages a terrain cost
+                        if (map["weights"].has_value()) {
+                            int maxWeight = std::get<int>(map["weights"].value()[0]);
+                            int scale = std::get<int>(map["weights"].value()[1]);
+
+                            builder.addWeights(maxWeight, scale);
+
+                            cout << " mazelib:  - Weights: 1 to " << maxWeight << " (scale " << scale << ")" << endl;
+                        }
+
                         // Set maze start point
                         if (map["start"].has_value()) {
                             int x = std::get<int>(map["start"].value()[0]);
@@ -273,6 +538,11 @@ int main(int argc, char **argv) {
                         cout << " mazeLib:  - Maze generating time: " << (maze.getGenerationTime() / 1000) << "us"
                              << endl;
 
+                        // Random walk statistics of Wilson's algorithm
+                        if (auto wilson = std::dynamic_pointer_cast<WilsonsAlgorithm>(generatingAlgorithm)) {
+                            cout << " mazeLib:  - Walk steps: " << wilson->getWalkSteps() << endl;
+                        }
+
                         cout << endl << " mazelib: Maze generated successfully! Took: " << (duration / 1000) << "us"
                              << endl;
                         cout << "" << endl;
@@ -319,6 +589,14 @@ int main(int argc, char **argv) {
                                .addArguments({"string"})
                                .setDescription("Path to the image, where maze will be saved")
             )
+            .addOption(Option("directionOptimizing")
+                               .addAliases({"-do", "--dirOpt"})
+                               .setDescription("Direction-optimizing bitmap search (BreadthFirstSearch)")
+            )
+            .addOption(Option("contracted")
+                               .addAliases({"-c", "--contract"})
+                               .setDescription("Search the cached junction graph (DijkstraAlgorithm)")
+            )
             .returns(
                     [=](std::map<std::string, std::optional<std::vector<std::variant<int, double, bool, std::string, std::nullopt_t>>>> map) {
 
@@ -383,6 +661,31 @@ int main(int argc, char **argv) {
                             return 1;
                         }
 
+                        // Solver modes
+                        if (std::get<bool>(map["directionOptimizing"].value()[0])) {
+                            auto breadthFirstSearch = std::dynamic_pointer_cast<BreadthFirstSearchAlgorithm>(solvingAlgorithm);
+
+                            if (breadthFirstSearch == nullptr) {
+                                cout << " mazelib:     - Direction optimization is only supported by BreadthFirstSearch" << endl;
+                                return 1;
+                            }
+
+                            breadthFirstSearch->setDirectionOptimizing(true);
+                            cout << " mazelib:  - Mode: direction-optimizing" << endl;
+                        }
+
+                        if (std::get<bool>(map["contracted"].value()[0])) {
+                            auto dijkstra = std::dynamic_pointer_cast<DijkstraAlgorithm>(solvingAlgorithm);
+
+                            if (dijkstra == nullptr) {
+                                cout << " mazelib:     - Contraction is only supported by DijkstraAlgorithm" << endl;
+                                return 1;
+                            }
+
+                            dijkstra->setContraction(true);
+                            cout << " mazelib:  - Mode: contracted" << endl;
+                        }
+
                         Expected<Maze> expected = builder.buildExpected();
 
                         // Check if maze is valid
@@ -437,20 +740,31 @@ int main(int argc, char **argv) {
                         cout << endl;
                         cout << " mazeLib: Gathering output: " << endl;
                         cout << " mazeLib:  - Maze path length: " << mazePath.getLength() << endl;
+                        cout << " mazeLib:  - Maze path cost: " << mazePath.getCost() << endl;
+
+                        if (auto aStar = std::dynamic_pointer_cast<AStarAlgorithm>(solvingAlgorithm)) {
+                            cout << " mazeLib:  - Nodes expanded: " << aStar->getNodesExpanded() << endl;
+                        }
+
+                        if (std::get<bool>(map["contracted"].value()[0])) {
+                            cout << " mazeLib:  - Junctions: " << maze.getJunctionGraph()->size() << " of "
+                                 << maze.getGraph()->size() << " cells" << endl;
+                        }
+
                         cout << " mazeLib:  - Maze path: " << endl;
                         cout << " mazeLib:     - ";
 
                         int count = 0;
                         for (const auto &point: mazePath.getNodes()) {
-                            if (point->getX() == get<0>(maze.getStart()) && point->getY() == get<1>(maze.getStart())) {
+                            if (point.getX() == get<0>(maze.getStart()) && point.getY() == get<1>(maze.getStart())) {
                                 cout << "Start --> ";
                                 count += 2;
                                 continue;
                             }
 
-                            cout << "(" << point->getX() << ", " << point->getY() << ") ";
+                            cout << "(" << point.getX() << ", " << point.getY() << ") ";
 
-                            if (point->getX() == get<0>(maze.getEnd()) && point->getY() == get<1>(maze.getEnd())) {
+                            if (point.getX() == get<0>(maze.getEnd()) && point.getY() == get<1>(maze.getEnd())) {
                                 cout << "-> End";
                             } else {
                                 cout << "-> ";
@@ -617,6 +931,7 @@ int main(int argc, char **argv) {
                                 MazePath path = mazePath.value();
 
                                 cout << " mazelib:     - Path length: " << mazePath.value().getLength() << endl;
+                                cout << " mazelib:     - Path cost: " << path.getCost() << endl;
                                 cout << " mazelib:     - Time taken: " << (path.getSolvingTime() / 1000) << "us"
                                      << endl;
                             }
@@ -1,4 +1,5 @@
 #include "Maze.h"
+#include "../algorithms/Random.h"
 
 /**
  * @brief Construct a new Maze:: Maze object
@@ -25,7 +26,8 @@ Maze::Maze(int width, int height, long long generationTime, std::string generati
           pathWidth(pathWidth),
           wallWidth(wallWidth),
           seed(seed),
-          graph(graph) {
+          graph(graph),
+          cache(std::make_shared<MazeCache>()) {
 
     // empty
 }
@@ -110,6 +112,50 @@ std::shared_ptr<Graph> Maze::getGraph() const {
     return this->graph;
 }
 
+/**
+ * Get the adjacency snapshot with the cache locked, dropping all snapshots built from an older graph version
+ * @return CSR adjacency snapshot of the current graph
+ */
+std::shared_ptr<Adjacency> Maze::getAdjacencyLocked() const {
+    if (this->cache->version != this->graph->getVersion()) {
+        this->cache->adjacency = nullptr;
+        this->cache->junctionGraph = nullptr;
+        this->cache->version = this->graph->getVersion();
+    }
+
+    if (this->cache->adjacency == nullptr) {
+        this->cache->adjacency = std::make_shared<Adjacency>(*this->graph);
+    }
+
+    return this->cache->adjacency;
+}
+
+/**
+ * Get the CSR adjacency snapshot of the maze graph, built on first use and rebuilt after the graph changes
+ * @return CSR adjacency snapshot of the current graph
+ */
+std::shared_ptr<Adjacency> Maze::getAdjacency() const {
+    std::lock_guard<std::mutex> lock(this->cache->mutex);
+
+    return this->getAdjacencyLocked();
+}
+
+/**
+ * Get the junction graph of the maze, with every corridor collapsed into one edge, built on first use and
+ * rebuilt after the graph changes
+ * @return junction graph of the current graph
+ */
+std::shared_ptr<JunctionGraph> Maze::getJunctionGraph() const {
+    std::lock_guard<std::mutex> lock(this->cache->mutex);
+    std::shared_ptr<Adjacency> adjacency = this->getAdjacencyLocked();
+
+    if (this->cache->junctionGraph == nullptr) {
+        this->cache->junctionGraph = std::make_shared<JunctionGraph>(*adjacency);
+    }
+
+    return this->cache->junctionGraph;
+}
+
 Expected<int> Maze::isValid() const {
     std::vector<std::string> errors;
 
@@ -168,9 +214,11 @@ Expected<int> Maze::isValid() const {
  * ====================================================
  */
 
-MazePath::MazePath(long long solvingTime, std::string solvingAlgorithm, std::vector<std::shared_ptr<Node>> nodes)
+MazePath::MazePath(long long solvingTime, std::string solvingAlgorithm, std::shared_ptr<Graph> graph,
+                   std::vector<Node> nodes)
         : solvingTime(solvingTime),
           solvingAlgorithm(solvingAlgorithm),
+          graph(graph),
           nodes(nodes) {
 
     // Nothing
@@ -200,6 +248,20 @@ int MazePath::getLength() const {
     return static_cast<int>(this->nodes.size());
 }
 
+/**
+ * @brief Get the total weight of the passages along the path, equal to the number of steps for unweighted mazes
+ * @return cost of the path
+ */
+long long MazePath::getCost() const {
+    long long cost = 0;
+
+    for (size_t i = 1; i < this->nodes.size(); i++) {
+        cost += this->graph->getWeight(this->nodes[i - 1], this->nodes[i]);
+    }
+
+    return cost;
+}
+
 /**
  * @brief Get the number of junctions in the path
  * @return junction count
@@ -208,7 +270,7 @@ int MazePath::getJunctionCount() const {
     int count = 0;
 
     for (const auto &node: this->nodes) {
-        if (node->getNeighbours().size() > 2) {
+        if (this->graph->getDegree(node) > 2) {
             count++;
         }
     }
@@ -220,7 +282,7 @@ int MazePath::getJunctionCount() const {
  * @brief Add a node to the path
  * @param node node to add
  */
-void MazePath::addNode(std::shared_ptr<Node> node) {
+void MazePath::addNode(Node node) {
     this->nodes.push_back(node);
 }
 
@@ -228,7 +290,7 @@ void MazePath::addNode(std::shared_ptr<Node> node) {
  * @brief Get the nodes of the path
  * @return Vector of nodes
  */
-std::vector<std::shared_ptr<Node>> MazePath::getNodes() const {
+const std::vector<Node> &MazePath::getNodes() const {
     return this->nodes;
 }
 
@@ -239,6 +301,10 @@ Expected<int> MazePath::isValid() const {
         errors.emplace_back("Path must have at least 2 nodes");
     }
 
+    if (this->graph == nullptr) {
+        errors.emplace_back("Path must belong to a graph");
+    }
+
     if (!errors.empty()) {
         return Expected<int>(errors);
     }
@@ -416,6 +482,206 @@ std::shared_ptr<Graph> MazeBuilder::getGraph() {
     return this->graph;
 }
 
+/**
+ * Braid the maze by opening one more wall of a given fraction of its dead ends, preferring walls to other
+ * dead ends. The graph is copied first, so mazes already built from this builder are not changed.
+ * @param fraction fraction of dead ends to remove, between 0 and 1
+ * @return number of removed dead ends
+ */
+int MazeBuilder::removeDeadEnds(double fraction) {
+    this->graph = std::make_shared<Graph>(this->graph->clone());
+
+    Grid &grid = this->graph->getGrid();
+    Random random(this->seed, 1);
+
+    uint64_t threshold = static_cast<uint64_t>(std::min(std::max(fraction, 0.0), 1.0) * 4294967296.0);
+    int removed = 0;
+
+    // Passage in the direction (0 = E, 1 = S, 2 = W, 3 = N), false when it would leave the grid
+    auto isOpen = [&](int x, int y, int direction) {
+        switch (direction) {
+            case 0: return x + 1 < this->width && grid.isOpenEast(x, y);
+            case 1: return y + 1 < this->height && grid.isOpenSouth(x, y);
+            case 2: return x > 0 && grid.isOpenEast(x - 1, y);
+            default: return y > 0 && grid.isOpenSouth(x, y - 1);
+        }
+    };
+
+    auto getDegree = [&](int x, int y) {
+        return isOpen(x, y, 0) + isOpen(x, y, 1) + isOpen(x, y, 2) + isOpen(x, y, 3);
+    };
+
+    const int dx[4] = {1, 0, -1, 0};
+    const int dy[4] = {0, 1, 0, -1};
+
+    for (int y = 0; y < this->height; y++) {
+        for (int x = 0; x < this->width; x++) {
+            if (getDegree(x, y) != 1 || (random.next() >> 32) >= threshold) {
+                continue;
+            }
+
+            // Closed walls to neighbours, dead end neighbours first
+            int directions[4] = {0, 0, 0, 0};
+            int count = 0;
+            int deadEnds = 0;
+
+            for (int direction = 0; direction < 4; direction++) {
+                int nx = x + dx[direction];
+                int ny = y + dy[direction];
+
+                if (nx < 0 || nx >= this->width || ny < 0 || ny >= this->height || isOpen(x, y, direction)) {
+                    continue;
+                }
+
+                if (getDegree(nx, ny) == 1) {
+                    directions[count++] = directions[deadEnds];
+                    directions[deadEnds++] = direction;
+                } else {
+                    directions[count++] = direction;
+                }
+            }
+
+            if (count == 0) {
+                continue;
+            }
+
+            int choice = static_cast<int>(random.nextBounded(deadEnds > 0 ? deadEnds : count));
+
+            switch (directions[choice]) {
+                case 0: grid.setOpenEast(x, y, true); break;
+                case 1: grid.setOpenSouth(x, y, true); break;
+                case 2: grid.setOpenEast(x - 1, y, true); break;
+                default: grid.setOpenSouth(x, y - 1, true); break;
+            }
+
+            removed++;
+        }
+    }
+
+    return removed;
+}
+
+/**
+ * Add loops to the maze by opening a given fraction of its closed inner walls, 64 walls at a time.
+ * The graph is copied first, so mazes already built from this builder are not changed.
+ * @param fraction fraction of closed walls to open, between 0 and 1
+ * @return number of opened walls
+ */
+int MazeBuilder::removeWalls(double fraction) {
+    this->graph = std::make_shared<Graph>(this->graph->clone());
+
+    Grid &grid = this->graph->getGrid();
+    Random random(this->seed, 2);
+
+    // Probability in 1/65536 steps, a word with bits set at that probability is built from its binary digits
+    uint32_t probability = static_cast<uint32_t>(std::min(std::max(fraction, 0.0), 1.0) * 65536.0 + 0.5);
+
+    auto nextWord = [&]() {
+        if (probability >= 65536) return ~uint64_t(0);
+
+        uint64_t word = 0;
+
+        for (int bit = 0; bit < 16; bit++) {
+            word = (probability >> bit) & 1 ? (word | random.next()) : (word & random.next());
+        }
+
+        return word;
+    };
+
+    int rowWords = grid.getRowWords();
+    uint64_t lastCells = this->width % 64 == 0 ? ~uint64_t(0) : (uint64_t(1) << (this->width % 64)) - 1;
+    uint64_t lastColumn = uint64_t(1) << ((this->width - 1) % 64);
+    int opened = 0;
+
+    for (int y = 0; y < this->height; y++) {
+        uint64_t *east = grid.getEastRow(y);
+        uint64_t *south = grid.getSouthRow(y);
+
+        for (int word = 0; word < rowWords; word++) {
+            uint64_t cells = word == rowWords - 1 ? lastCells : ~uint64_t(0);
+            uint64_t eastCells = word == rowWords - 1 ? cells & ~lastColumn : cells;
+
+            uint64_t eastOpened = ~east[word] & eastCells & nextWord();
+            east[word] |= eastOpened;
+            opened += __builtin_popcountll(eastOpened);
+
+            if (y < this->height - 1) {
+                uint64_t southOpened = ~south[word] & cells & nextWord();
+                south[word] |= southOpened;
+                opened += __builtin_popcountll(southOpened);
+            }
+        }
+    }
+
+    return opened;
+}
+
+/**
+ * Give every passage a terrain cost from a smooth random field. Random heights are placed on a lattice with a
+ * spacing of scale cells and interpolated in between, a passage costs the mean height of its two cells mapped
+ * to [1, maxWeight]. Closed walls get a cost as well, so passages opened later are weighted too.
+ * The graph is copied first, so mazes already built from this builder are not changed.
+ * @param maxWeight largest passage cost, between 1 and 255
+ * @param scale size of the terrain features in cells, 1 gives independent costs
+ */
+void MazeBuilder::addWeights(int maxWeight, int scale) {
+    this->graph = std::make_shared<Graph>(this->graph->clone());
+
+    Grid &grid = this->graph->getGrid();
+    Random random(this->seed, 3);
+
+    maxWeight = std::min(std::max(maxWeight, 1), 255);
+    scale = std::max(scale, 1);
+
+    int latticeWidth = (this->width - 1) / scale + 2;
+    int latticeHeight = (this->height - 1) / scale + 2;
+    std::vector<double> lattice(static_cast<size_t>(latticeWidth) * latticeHeight);
+
+    for (double &value: lattice) {
+        value = static_cast<double>(random.next() >> 11) / 9007199254740992.0;
+    }
+
+    // Height of the cell between 0 and 1, bilinear between the four surrounding lattice points
+    auto getHeight = [&](int x, int y) {
+        int column = x / scale;
+        int row = y / scale;
+        double fx = static_cast<double>(x % scale) / scale;
+        double fy = static_cast<double>(y % scale) / scale;
+
+        const double *top = lattice.data() + static_cast<size_t>(row) * latticeWidth + column;
+        const double *bottom = top + latticeWidth;
+
+        return (top[0] * (1 - fx) + top[1] * fx) * (1 - fy) + (bottom[0] * (1 - fx) + bottom[1] * fx) * fy;
+    };
+
+    auto getWeight = [&](double a, double b) {
+        return 1 + static_cast<int>((maxWeight - 1) * (a + b) / 2 + 0.5);
+    };
+
+    // Heights of the current and the next row
+    std::vector<double> current(this->width);
+    std::vector<double> next(this->width);
+
+    for (int x = 0; x < this->width; x++) {
+        current[x] = getHeight(x, 0);
+    }
+
+    for (int y = 0; y < this->height; y++) {
+        if (y + 1 < this->height) {
+            for (int x = 0; x < this->width; x++) {
+                next[x] = getHeight(x, y + 1);
+            }
+        }
+
+        for (int x = 0; x < this->width; x++) {
+            if (x + 1 < this->width) grid.setWeightEast(x, y, getWeight(current[x], current[x + 1]));
+            if (y + 1 < this->height) grid.setWeightSouth(x, y, getWeight(current[x], next[x]));
+        }
+
+        current.swap(next);
+    }
+}
+
 /**
  * Build the maze
  * @return maze
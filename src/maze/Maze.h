@@ -4,9 +4,21 @@
 #include <vector>
 #include <memory>
 #include <tuple>
+#include <mutex>
 #include "../graph/Graph.h"
 #include "../headers/Expected.h"
 
+/**
+ * @brief Snapshots derived from the graph of a maze. Copies of a maze share the graph and therefore the cache,
+ * the snapshots are rebuilt when the version of the graph no longer matches the one they were built from.
+ */
+struct MazeCache {
+    std::mutex mutex;
+    uint64_t version = 0;
+    std::shared_ptr<Adjacency> adjacency;
+    std::shared_ptr<JunctionGraph> junctionGraph;
+};
+
 class Maze {
 private:
     int width;
@@ -19,6 +31,9 @@ private:
     int wallWidth;
     unsigned int seed;
     std::shared_ptr<Graph> graph;
+    std::shared_ptr<MazeCache> cache;
+
+    std::shared_ptr<Adjacency> getAdjacencyLocked() const;
 
 public:
     Maze(int width, int height, long long generationTime, std::string generationAlgorithm,
@@ -47,6 +62,10 @@ public:
 
     std::shared_ptr<Graph> getGraph() const;
 
+    std::shared_ptr<Adjacency> getAdjacency() const;
+
+    std::shared_ptr<JunctionGraph> getJunctionGraph() const;
+
     Expected<int> isValid() const;
 };
 
@@ -54,10 +73,12 @@ class MazePath {
 private:
     long long solvingTime;
     std::string solvingAlgorithm;
-    std::vector<std::shared_ptr<Node>> nodes;
+    std::shared_ptr<Graph> graph;
+    std::vector<Node> nodes;
 
 public:
-    MazePath(long long solvingTime, std::string solvingAlgorithm, std::vector<std::shared_ptr<Node>> nodes);
+    MazePath(long long solvingTime, std::string solvingAlgorithm, std::shared_ptr<Graph> graph,
+             std::vector<Node> nodes);
 
     ~MazePath() = default;
 
@@ -67,11 +88,13 @@ public:
 
     int getLength() const;
 
+    long long getCost() const;
+
     int getJunctionCount() const;
 
-    void addNode(std::shared_ptr<Node> node);
+    void addNode(Node node);
 
-    std::vector<std::shared_ptr<Node>> getNodes() const;
+    const std::vector<Node> &getNodes() const;
 
     Expected<int> isValid() const;
 };
@@ -128,6 +151,12 @@ public:
 
     std::shared_ptr<Graph> getGraph();
 
+    int removeDeadEnds(double fraction);
+
+    int removeWalls(double fraction);
+
+    void addWeights(int maxWeight, int scale);
+
     // TODO-Extra: Switch this methods output
     Maze build();
 
@@ -24,6 +24,7 @@ Expected<int> ImageSavingMethod::save(const Maze &maze, std::string fileName, st
     int width = maze.getWidth() * pathWidth + maze.getWidth() * wallWidth + wallWidth;
     int height = maze.getHeight() * pathWidth + maze.getHeight() * wallWidth + wallWidth;
 
+    const Graph &graph = *maze.getGraph();
     Image image = Image(width, height);
 
     // Draw border
@@ -33,17 +34,18 @@ Expected<int> ImageSavingMethod::save(const Maze &maze, std::string fileName, st
 
     // Draw the route
     if (path != std::nullopt) {
-        auto currentNode = maze.getGraph()->getNode(maze.getStart());
+        Node startNode = graph.getNode(maze.getStart());
+        Node currentNode = startNode;
 
         for (const auto &node: path.value().getNodes()) {
-            if (currentNode != maze.getGraph()->getNode(maze.getStart())) {
+            if (currentNode != startNode) {
                 image.drawLine(
-                        (currentNode->getX() * pathWidth) + (currentNode->getX() * wallWidth) + (pathWidth / 2) +
+                        (currentNode.getX() * pathWidth) + (currentNode.getX() * wallWidth) + (pathWidth / 2) +
                         wallWidth,
-                        (currentNode->getY() * pathWidth) + (currentNode->getY() * wallWidth) + (pathWidth / 2) +
+                        (currentNode.getY() * pathWidth) + (currentNode.getY() * wallWidth) + (pathWidth / 2) +
                         wallWidth,
-                        (node->getX() * pathWidth) + (node->getX() * wallWidth) + (pathWidth / 2) + wallWidth,
-                        (node->getY() * pathWidth) + (node->getY() * wallWidth) + (pathWidth / 2) + wallWidth,
+                        (node.getX() * pathWidth) + (node.getX() * wallWidth) + (pathWidth / 2) + wallWidth,
+                        (node.getY() * pathWidth) + (node.getY() * wallWidth) + (pathWidth / 2) + wallWidth,
                         pointWidth,
                         PATH_COLOR
                 );
@@ -53,17 +55,17 @@ Expected<int> ImageSavingMethod::save(const Maze &maze, std::string fileName, st
         }
     }
 
-    for (const auto &node: maze.getGraph()->getNodes()) {
+    for (const Node node: graph.getNodeRange()) {
 
         // Draw start node
-        if (node->getX() == std::get<0>(maze.getStart()) && node->getY() == std::get<1>(maze.getStart())) {
+        if (node.getX() == std::get<0>(maze.getStart()) && node.getY() == std::get<1>(maze.getStart())) {
             if (pathWidth % 2 == 0) {
                 for (int x = 0; x < 2; x++) {
                     for (int y = 0; y < 2; y++) {
                         image.drawFillCircle(
-                                (node->getX() * pathWidth) + (node->getX() * wallWidth) + (pathWidth / 2) + wallWidth -
+                                (node.getX() * pathWidth) + (node.getX() * wallWidth) + (pathWidth / 2) + wallWidth -
                                 x,
-                                (node->getY() * pathWidth) + (node->getY() * wallWidth) + (pathWidth / 2) + wallWidth -
+                                (node.getY() * pathWidth) + (node.getY() * wallWidth) + (pathWidth / 2) + wallWidth -
                                 y,
                                 pointWidth,
                                 START_COLOR
@@ -72,8 +74,8 @@ Expected<int> ImageSavingMethod::save(const Maze &maze, std::string fileName, st
                 }
             } else {
                 image.drawFillCircle(
-                        (node->getX() * pathWidth) + (node->getX() * wallWidth) + (pathWidth / 2) + wallWidth,
-                        (node->getY() * pathWidth) + (node->getY() * wallWidth) + (pathWidth / 2) + wallWidth,
+                        (node.getX() * pathWidth) + (node.getX() * wallWidth) + (pathWidth / 2) + wallWidth,
+                        (node.getY() * pathWidth) + (node.getY() * wallWidth) + (pathWidth / 2) + wallWidth,
                         pointWidth,
                         START_COLOR
                 );
@@ -81,14 +83,14 @@ Expected<int> ImageSavingMethod::save(const Maze &maze, std::string fileName, st
         }
 
         // Draw end node
-        if (node->getX() == std::get<0>(maze.getEnd()) && node->getY() == std::get<1>(maze.getEnd())) {
+        if (node.getX() == std::get<0>(maze.getEnd()) && node.getY() == std::get<1>(maze.getEnd())) {
             if (pathWidth % 2 == 0) {
                 for (int x = 0; x < 2; x++) {
                     for (int y = 0; y < 2; y++) {
                         image.drawFillCircle(
-                                (node->getX() * pathWidth) + (node->getX() * wallWidth) + (pathWidth / 2) + wallWidth -
+                                (node.getX() * pathWidth) + (node.getX() * wallWidth) + (pathWidth / 2) + wallWidth -
                                 x,
-                                (node->getY() * pathWidth) + (node->getY() * wallWidth) + (pathWidth / 2) + wallWidth -
+                                (node.getY() * pathWidth) + (node.getY() * wallWidth) + (pathWidth / 2) + wallWidth -
                                 y,
                                 pointWidth,
                                 END_COLOR
@@ -97,8 +99,8 @@ Expected<int> ImageSavingMethod::save(const Maze &maze, std::string fileName, st
                 }
             } else {
                 image.drawFillCircle(
-                        (node->getX() * pathWidth) + (node->getX() * wallWidth) + (pathWidth / 2) + wallWidth,
-                        (node->getY() * pathWidth) + (node->getY() * wallWidth) + (pathWidth / 2) + wallWidth,
+                        (node.getX() * pathWidth) + (node.getX() * wallWidth) + (pathWidth / 2) + wallWidth,
+                        (node.getY() * pathWidth) + (node.getY() * wallWidth) + (pathWidth / 2) + wallWidth,
                         pointWidth,
                         END_COLOR
                 );
@@ -109,16 +111,16 @@ Expected<int> ImageSavingMethod::save(const Maze &maze, std::string fileName, st
         bool topWall = true;
 
         // Check neighbours of node for wall drawing
-        for (const auto &neighbour: node->getNeighbours()) {
-            if (neighbour->getX() == node->getX() - 1) leftWall = false;
-            if (neighbour->getY() == node->getY() - 1) topWall = false;
+        for (const auto &neighbour: graph.getNeighbourRange(node)) {
+            if (neighbour.getX() == node.getX() - 1) leftWall = false;
+            if (neighbour.getY() == node.getY() - 1) topWall = false;
         }
 
         // Draw left wall
         if (leftWall) {
             image.drawFillRect(
-                    node->getX() * pathWidth + node->getX() * wallWidth,
-                    node->getY() * pathWidth + node->getY() * wallWidth,
+                    node.getX() * pathWidth + node.getX() * wallWidth,
+                    node.getY() * pathWidth + node.getY() * wallWidth,
                     wallWidth,
                     pathWidth + wallWidth * 2,
                     WALL_COLOR
@@ -128,8 +130,8 @@ Expected<int> ImageSavingMethod::save(const Maze &maze, std::string fileName, st
         // Draw top wall
         if (topWall) {
             image.drawFillRect(
-                    node->getX() * pathWidth + node->getX() * wallWidth,
-                    node->getY() * pathWidth + node->getY() * wallWidth,
+                    node.getX() * pathWidth + node.getX() * wallWidth,
+                    node.getY() * pathWidth + node.getY() * wallWidth,
                     pathWidth + wallWidth * 2,
                     wallWidth,
                     WALL_COLOR
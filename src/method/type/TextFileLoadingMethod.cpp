@@ -37,17 +37,45 @@ Expected<MazeBuilder> TextFileLoadingMethod::load(std::string fileName) {
     // TODO: Fix loading seed as unsigned int from text file
     unsigned int seed = json["seed"].get<nlohmann::json::number_float_t>();
 
+    if (width <= 0 || height <= 0) {
+        return Expected<MazeBuilder>("Width and height must be greater than 0");
+    }
+
     std::shared_ptr<Graph> graph = std::make_shared<Graph>(width, height);
 
+    auto isInside = [&](int x, int y) {
+        return x >= 0 && x < width && y >= 0 && y < height;
+    };
+
     for (const auto &node: json["mazeNodes"]) {
         int x = node["x"];
         int y = node["y"];
 
+        if (!isInside(x, y)) {
+            return Expected<MazeBuilder>("Maze nodes must lie inside the maze");
+        }
+
         for (const auto &neighbor: node["neighbors"]) {
             int neighborX = neighbor["x"];
             int neighborY = neighbor["y"];
 
-            graph->getNode(x, y)->addNeighbour(graph->getNode(neighborX, neighborY));
+            if (!isInside(neighborX, neighborY)) {
+                return Expected<MazeBuilder>("Maze nodes must lie inside the maze");
+            }
+
+            if (!graph->connect(graph->getNode(x, y), graph->getNode(neighborX, neighborY))) {
+                return Expected<MazeBuilder>("Maze nodes can only neighbour adjacent nodes");
+            }
+
+            if (neighbor.contains("weight")) {
+                int weight = neighbor["weight"];
+
+                if (weight < 1 || weight > 255) {
+                    return Expected<MazeBuilder>("Passage weights must be between 1 and 255");
+                }
+
+                graph->setWeight(graph->getNode(x, y), graph->getNode(neighborX, neighborY), weight);
+            }
         }
     }
 
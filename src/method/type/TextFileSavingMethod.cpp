@@ -33,19 +33,27 @@ Expected<int> TextFileSavingMethod::save(const Maze &maze, std::string fileName,
     };
 
     json nodes;
+    const Graph &graph = *maze.getGraph();
 
-    for (const auto &node: maze.getGraph()->getNodes()) {
+    for (const Node node: graph.getNodeRange()) {
         json nodeObject = {
-                {"x",         node->getX()},
-                {"y",         node->getY()},
+                {"x",         node.getX()},
+                {"y",         node.getY()},
                 {"neighbors", {}}
         };
 
-        for (const auto &neighbor: node->getNeighbours()) {
-            nodeObject["neighbors"].push_back({
-                                                      {"x", neighbor->getX()},
-                                                      {"y", neighbor->getY()}
-                                              });
+        for (const auto &neighbor: graph.getNeighbourRange(node)) {
+            json neighborObject = {
+                    {"x", neighbor.getX()},
+                    {"y", neighbor.getY()}
+            };
+
+            // Weights are only written for weighted mazes, so unweighted files keep their format
+            if (graph.isWeighted()) {
+                neighborObject["weight"] = graph.getWeight(node, neighbor);
+            }
+
+            nodeObject["neighbors"].push_back(neighborObject);
         }
 
         nodes.push_back(nodeObject);
@@ -58,8 +66,8 @@ Expected<int> TextFileSavingMethod::save(const Maze &maze, std::string fileName,
 
         for (const auto &node: path.value().getNodes()) {
             paths.push_back({
-                                    {"x", node->getX()},
-                                    {"y", node->getY()}
+                                    {"x", node.getX()},
+                                    {"y", node.getY()}
                             });
         }
 
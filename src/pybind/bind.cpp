@@ -69,7 +69,19 @@ PYBIND11_MODULE(mazeLib, m) {
     // Bind the GeneratingAlgorithm class
     py::class_<GeneratingAlgorithm, Algorithm, std::shared_ptr<GeneratingAlgorithm>>(m, "GeneratingAlgorithm")
             //      .def(py::init<std::string, unsigned int>())
-            .def("setSeed", &GeneratingAlgorithm::setSeed);
+            .def("setSeed", &GeneratingAlgorithm::setSeed)
+            .def("setThreads", &GeneratingAlgorithm::setThreads)
+            .def("getThreads", &GeneratingAlgorithm::getThreads)
+            .def_static("getBatchSeed", &GeneratingAlgorithm::getBatchSeed)
+            .def("generateBatch",
+                 (std::vector<Expected<MazeBuilder>> (GeneratingAlgorithm::*)(int, int, int, unsigned int, int))
+                         &GeneratingAlgorithm::generateBatch,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("generateBatch",
+                 (void (GeneratingAlgorithm::*)(int, int, int, unsigned int, int,
+                                                const std::function<void(int, Expected<MazeBuilder> &)> &))
+                         &GeneratingAlgorithm::generateBatch,
+                 py::call_guard<py::gil_scoped_release>());
 
     // Bind the KruskalAlgorithm class
     py::class_<KruskalAlgorithm, GeneratingAlgorithm, std::shared_ptr<KruskalAlgorithm>>(m, "KruskalAlgorithm")
@@ -77,9 +89,67 @@ PYBIND11_MODULE(mazeLib, m) {
             .def(py::init<unsigned int>())
             .def("generate", &KruskalAlgorithm::generate);
 
+    // Bind the ParallelKruskalAlgorithm class
+    py::class_<ParallelKruskalAlgorithm, GeneratingAlgorithm, std::shared_ptr<ParallelKruskalAlgorithm>>(m,
+                                                                                                      "ParallelKruskalAlgorithm")
+            .def(py::init())
+            .def(py::init<unsigned int>())
+            .def("generate", &ParallelKruskalAlgorithm::generate);
+
+    // Bind the RecursiveBacktrackerAlgorithm class
+    py::class_<RecursiveBacktrackerAlgorithm, GeneratingAlgorithm, std::shared_ptr<RecursiveBacktrackerAlgorithm>>(m, "RecursiveBacktrackerAlgorithm")
+            .def(py::init())
+            .def(py::init<unsigned int>())
+            .def("generate", &RecursiveBacktrackerAlgorithm::generate);
+
+    // Bind the EllersAlgorithm class
+    py::class_<EllersAlgorithm, GeneratingAlgorithm, std::shared_ptr<EllersAlgorithm>>(m, "EllersAlgorithm")
+            .def(py::init())
+            .def(py::init<unsigned int>())
+            .def("generate", &EllersAlgorithm::generate)
+            .def("generateToFile", &EllersAlgorithm::generateToFile);
+
+    // Bind the WilsonsAlgorithm class
+    py::class_<WilsonsAlgorithm, GeneratingAlgorithm, std::shared_ptr<WilsonsAlgorithm>>(m, "WilsonsAlgorithm")
+            .def(py::init())
+            .def(py::init<unsigned int>())
+            .def("generate", &WilsonsAlgorithm::generate)
+            .def("getWalkSteps", &WilsonsAlgorithm::getWalkSteps);
+
+    // Bind the PrimsAlgorithm class
+    py::class_<PrimsAlgorithm, GeneratingAlgorithm, std::shared_ptr<PrimsAlgorithm>>(m, "PrimsAlgorithm")
+            .def(py::init())
+            .def(py::init<unsigned int>())
+            .def("generate", &PrimsAlgorithm::generate);
+
+    // Bind the BinaryTreeAlgorithm class
+    py::class_<BinaryTreeAlgorithm, GeneratingAlgorithm, std::shared_ptr<BinaryTreeAlgorithm>>(m, "BinaryTreeAlgorithm")
+            .def(py::init())
+            .def(py::init<unsigned int>())
+            .def("generate", &BinaryTreeAlgorithm::generate);
+
+    // Bind the SidewinderAlgorithm class
+    py::class_<SidewinderAlgorithm, GeneratingAlgorithm, std::shared_ptr<SidewinderAlgorithm>>(m, "SidewinderAlgorithm")
+            .def(py::init())
+            .def(py::init<unsigned int>())
+            .def("generate", &SidewinderAlgorithm::generate);
+
+    // Bind the RecursiveDivisionAlgorithm class
+    py::class_<RecursiveDivisionAlgorithm, GeneratingAlgorithm, std::shared_ptr<RecursiveDivisionAlgorithm>>(m, "RecursiveDivisionAlgorithm")
+            .def(py::init())
+            .def(py::init<unsigned int>())
+            .def("generate", &RecursiveDivisionAlgorithm::generate);
+
+    // Bind the HuntAndKillAlgorithm class
+    py::class_<HuntAndKillAlgorithm, GeneratingAlgorithm, std::shared_ptr<HuntAndKillAlgorithm>>(m, "HuntAndKillAlgorithm")
+            .def(py::init())
+            .def(py::init<unsigned int>())
+            .def("generate", &HuntAndKillAlgorithm::generate);
+
     // Bind the SolvingAlgorithm class
     py::class_<SolvingAlgorithm, Algorithm, std::shared_ptr<SolvingAlgorithm>>(m, "SolvingAlgorithm")
             //      .def(py::init<std::string>())
+            .def("setSeed", &SolvingAlgorithm::setSeed)
             .def("solve", &SolvingAlgorithm::solve);
 
     // Bind the WallFollowingAlgorithm class
@@ -97,8 +167,16 @@ PYBIND11_MODULE(mazeLib, m) {
     py::class_<BreadthFirstSearchAlgorithm, SolvingAlgorithm, std::shared_ptr<BreadthFirstSearchAlgorithm>>(m,
                                                                                                             "BreadthFirstSearchAlgorithm")
             .def(py::init())
+            .def("setDirectionOptimizing", &BreadthFirstSearchAlgorithm::setDirectionOptimizing)
+            .def("getDirectionOptimizing", &BreadthFirstSearchAlgorithm::getDirectionOptimizing)
             .def("solve", &BreadthFirstSearchAlgorithm::solve);
 
+    // Bind the BidirectionalBreadthFirstSearchAlgorithm class
+    py::class_<BidirectionalBreadthFirstSearchAlgorithm, SolvingAlgorithm,
+            std::shared_ptr<BidirectionalBreadthFirstSearchAlgorithm>>(m, "BidirectionalBreadthFirstSearchAlgorithm")
+            .def(py::init())
+            .def("solve", &BidirectionalBreadthFirstSearchAlgorithm::solve);
+
     // Bind the DepthFirstSearchAlgorithm class
     py::class_<DepthFirstSearchAlgorithm, SolvingAlgorithm, std::shared_ptr<DepthFirstSearchAlgorithm>>(m,
                                                                                                         "DepthFirstSearchAlgorithm")
@@ -113,32 +191,110 @@ PYBIND11_MODULE(mazeLib, m) {
     // Bind the DijkstraAlgorithm class
     py::class_<DijkstraAlgorithm, SolvingAlgorithm, std::shared_ptr<DijkstraAlgorithm>>(m, "DijkstraAlgorithm")
             .def(py::init())
+            .def("setBucketQueue", &DijkstraAlgorithm::setBucketQueue)
+            .def("getBucketQueue", &DijkstraAlgorithm::getBucketQueue)
+            .def("setContraction", &DijkstraAlgorithm::setContraction)
+            .def("getContraction", &DijkstraAlgorithm::getContraction)
             .def("solve", &DijkstraAlgorithm::solve);
 
+    // Bind the AStarAlgorithm class
+    py::class_<AStarAlgorithm, SolvingAlgorithm, std::shared_ptr<AStarAlgorithm>>(m, "AStarAlgorithm")
+            .def(py::init())
+            .def("solve", &AStarAlgorithm::solve)
+            .def("getNodesExpanded", &AStarAlgorithm::getNodesExpanded);
+
+    // Bind the DeadEndFillingAlgorithm class
+    py::class_<DeadEndFillingAlgorithm, SolvingAlgorithm, std::shared_ptr<DeadEndFillingAlgorithm>>(m, "DeadEndFillingAlgorithm")
+            .def(py::init())
+            .def("setThreads", &DeadEndFillingAlgorithm::setThreads)
+            .def("getThreads", &DeadEndFillingAlgorithm::getThreads)
+            .def("solve", &DeadEndFillingAlgorithm::solve);
+
     // Bind the Node class
     py::class_<Node>(m, "Node")
             .def(py::init<int, int>())
             .def("getX", &Node::getX)
             .def("getY", &Node::getY)
-            .def("setID", &Node::setID)
-            .def("getID", &Node::getID)
-            .def("addNeighbour", &Node::addNeighbour)
-            .def("getNeighbours", &Node::getNeighbours)
+            .def(py::self == py::self)
+            .def(py::self != py::self)
             .def("__str__", [](const Node &node) {
                 return "(" + std::to_string(node.getX()) + "," + std::to_string(node.getY()) + ")";
             });
 
+    // Bind the Grid class
+    py::class_<Grid>(m, "Grid")
+            .def(py::init<int, int>())
+            .def("getWidth", &Grid::getWidth)
+            .def("getHeight", &Grid::getHeight)
+            .def("size", &Grid::size)
+            .def("isOpenEast", &Grid::isOpenEast)
+            .def("isOpenSouth", &Grid::isOpenSouth)
+            .def("setOpenEast", &Grid::setOpenEast)
+            .def("setOpenSouth", &Grid::setOpenSouth)
+            .def("isWeighted", &Grid::isWeighted)
+            .def("getWeightEast", &Grid::getWeightEast)
+            .def("getWeightSouth", &Grid::getWeightSouth)
+            .def("setWeightEast", &Grid::setWeightEast)
+            .def("setWeightSouth", &Grid::setWeightSouth)
+            .def("clearWeights", &Grid::clearWeights)
+            .def("getMemoryUsage", &Grid::getMemoryUsage);
+
     // Bind the Graph class
-    py::class_<Graph>(m, "Graph")
+    py::class_<Graph, std::shared_ptr<Graph>>(m, "Graph")
             .def(py::init<int, int>())
             .def("getWidth", &Graph::getWidth)
             .def("getHeight", &Graph::getHeight)
+            .def("getGrid", (const Grid &(Graph::*)() const) &Graph::getGrid, py::return_value_policy::reference_internal)
             .def("getNodes", &Graph::getNodes)
-            .def("getNode", (std::shared_ptr<Node> (Graph::*)(Coordinate)) &Graph::getNode)
-            .def("getNode", (std::shared_ptr<Node> (Graph::*)(int, int)) &Graph::getNode)
+            .def("getNode", (Node (Graph::*)(Coordinate) const) &Graph::getNode)
+            .def("getNode", (Node (Graph::*)(int, int) const) &Graph::getNode)
+            .def("getNode", (Node (Graph::*)(int) const) &Graph::getNode)
+            .def("getIndex", &Graph::getIndex)
+            .def("getNeighbours", &Graph::getNeighbours)
+            .def("getDegree", &Graph::getDegree)
+            .def("isConnected", &Graph::isConnected)
+            .def("connect", &Graph::connect)
+            .def("disconnect", &Graph::disconnect)
+            .def("isWeighted", &Graph::isWeighted)
+            .def("getWeight", &Graph::getWeight)
+            .def("setWeight", &Graph::setWeight)
             .def("size", &Graph::size)
             .def("clone", &Graph::clone);
 
+    // Bind the Adjacency class
+    py::class_<Adjacency, std::shared_ptr<Adjacency>>(m, "Adjacency")
+            .def(py::init<const Graph &>())
+            .def("getWidth", &Adjacency::getWidth)
+            .def("getHeight", &Adjacency::getHeight)
+            .def("size", &Adjacency::size)
+            .def("getOffsets", &Adjacency::getOffsets)
+            .def("getTargets", &Adjacency::getTargets)
+            .def("isWeighted", &Adjacency::isWeighted)
+            .def("getWeights", &Adjacency::getWeights)
+            .def("getMinWeight", &Adjacency::getMinWeight)
+            .def("getDegree", &Adjacency::getDegree);
+
+    // Bind the JunctionGraph class
+    py::class_<JunctionGraph, std::shared_ptr<JunctionGraph>>(m, "JunctionGraph")
+            .def(py::init<const Adjacency &>())
+            .def("size", &JunctionGraph::size)
+            .def("getCorridorCount", &JunctionGraph::getCorridorCount)
+            .def("getCells", &JunctionGraph::getCells)
+            .def("getLocations", &JunctionGraph::getLocations)
+            .def("getOffsets", &JunctionGraph::getOffsets)
+            .def("getTargets", &JunctionGraph::getTargets)
+            .def("getCosts", &JunctionGraph::getCosts)
+            .def("getEdgeCorridors", &JunctionGraph::getEdgeCorridors)
+            .def("getCorridorStarts", &JunctionGraph::getCorridorStarts)
+            .def("getCorridorCells", &JunctionGraph::getCorridorCells)
+            .def("getCorridorCosts", &JunctionGraph::getCorridorCosts)
+            .def("getCorridorEnds", &JunctionGraph::getCorridorEnds)
+            .def("expandEdge", [](const JunctionGraph &junctions, int edge) {
+                std::vector<uint32_t> path;
+                junctions.expandEdge(edge, path);
+                return path;
+            });
+
     // Bind the Maze class
     py::class_<Maze>(m, "Maze")
             .def(py::init<int, int, long long, std::string, Coordinate, Coordinate, int, int, unsigned int, std::shared_ptr<Graph> &>())
@@ -152,14 +308,17 @@ PYBIND11_MODULE(mazeLib, m) {
             .def("getWallWidth", &Maze::getWallWidth)
             .def("getSeed", &Maze::getSeed)
             .def("getGraph", &Maze::getGraph)
+            .def("getAdjacency", &Maze::getAdjacency)
+            .def("getJunctionGraph", &Maze::getJunctionGraph)
             .def("isValid", &Maze::isValid);
 
     // Bind the MazePath class
     py::class_<MazePath>(m, "MazePath")
-            .def(py::init<long long, std::string, std::vector<std::shared_ptr<Node>>>())
+            .def(py::init<long long, std::string, std::shared_ptr<Graph>, std::vector<Node>>())
             .def("getSolvingAlgorithm", &MazePath::getSolvingAlgorithm)
             .def("getSolvingTime", &MazePath::getSolvingTime)
             .def("getLength", &MazePath::getLength)
+            .def("getCost", &MazePath::getCost)
             .def("getJunctionCount", &MazePath::getJunctionCount)
             .def("addNode", &MazePath::addNode)
             .def("getNodes", &MazePath::getNodes)
@@ -185,6 +344,9 @@ PYBIND11_MODULE(mazeLib, m) {
             .def("getSeed", &MazeBuilder::getSeed)
             .def("setGraph", &MazeBuilder::setGraph)
             .def("getGraph", &MazeBuilder::getGraph)
+            .def("removeDeadEnds", &MazeBuilder::removeDeadEnds)
+            .def("removeWalls", &MazeBuilder::removeWalls)
+            .def("addWeights", &MazeBuilder::addWeights)
             .def("build", &MazeBuilder::build)
             .def("buildExpected", &MazeBuilder::buildExpected);
 